@@ -0,0 +1,122 @@
+if(NOT DEFINED BENCH_SHAPE)
+  message(FATAL_ERROR "BENCH_SHAPE is required")
+endif()
+if(NOT DEFINED BENCH_SIZE)
+  message(FATAL_ERROR "BENCH_SIZE is required")
+endif()
+if(NOT DEFINED BENCH_OUTPUT_DIR)
+  message(FATAL_ERROR "BENCH_OUTPUT_DIR is required")
+endif()
+if(NOT DEFINED BENCH_TEMPLATE_DIR)
+  message(FATAL_ERROR "BENCH_TEMPLATE_DIR is required")
+endif()
+
+set(case_toml "${BENCH_OUTPUT_DIR}/case.toml")
+file(MAKE_DIRECTORY "${BENCH_OUTPUT_DIR}")
+file(WRITE "${case_toml}" "")
+
+math(EXPR last "${BENCH_SIZE} - 1")
+set(text "")
+
+# Appending to one large CMake string is quadratic; flush to disk in chunks.
+macro(flush_text index)
+  math(EXPR flush_due "${index} % 1000")
+  if(flush_due EQUAL 0)
+    file(APPEND "${case_toml}" "${text}")
+    set(text "")
+  endif()
+endmacro()
+
+if(BENCH_SHAPE STREQUAL "flat")
+  foreach(i RANGE ${last})
+    math(EXPR kind "${i} % 4")
+    if(kind EQUAL 0)
+      string(APPEND text "key_${i} = ${i}\n")
+    elseif(kind EQUAL 1)
+      string(APPEND text "key_${i} = \"value ${i}\"\n")
+    elseif(kind EQUAL 2)
+      string(APPEND text "key_${i} = ${i}.25\n")
+    else()
+      string(APPEND text "key_${i} = true\n")
+    endif()
+    flush_text(${i})
+  endforeach()
+elseif(BENCH_SHAPE STREQUAL "deep")
+  set(header "level_0")
+  string(APPEND text "[${header}]\ndepth = 0\n")
+  foreach(i RANGE 1 ${last})
+    string(APPEND header ".level_${i}")
+    string(APPEND text "\n# depth ${i}\n[${header}]\ndepth = ${i}\nname = \"node ${i}\"\n")
+    flush_text(${i})
+  endforeach()
+elseif(BENCH_SHAPE STREQUAL "wide_array")
+  string(APPEND text "values = [")
+  foreach(i RANGE ${last})
+    math(EXPR column "${i} % 16")
+    if(column EQUAL 0)
+      string(APPEND text "\n ")
+    endif()
+    string(APPEND text " ${i},")
+    flush_text(${i})
+  endforeach()
+  string(APPEND text "\n]\nmixed = [")
+  foreach(i RANGE ${last})
+    math(EXPR column "${i} % 8")
+    if(column EQUAL 0)
+      string(APPEND text "\n ")
+    endif()
+    math(EXPR kind "${i} % 2")
+    if(kind EQUAL 0)
+      string(APPEND text " ${i},")
+    else()
+      string(APPEND text " \"v${i}\",")
+    endif()
+    flush_text(${i})
+  endforeach()
+  string(APPEND text "\n]\n")
+elseif(BENCH_SHAPE STREQUAL "float_array")
+  string(APPEND text "values = [")
+  foreach(i RANGE ${last})
+    math(EXPR column "${i} % 8")
+    if(column EQUAL 0)
+      string(APPEND text "\n ")
+    endif()
+    math(EXPR kind "${i} % 4")
+    math(EXPR scale "${i} % 19")
+    if(kind EQUAL 0)
+      string(APPEND text " ${i}.${scale}25,")
+    elseif(kind EQUAL 1)
+      string(APPEND text " ${i}.0e-${scale},")
+    elseif(kind EQUAL 2)
+      string(APPEND text " -0.${i}${i}${i}e${scale},")
+    else()
+      string(APPEND text " 3.141_592_653_589_793_238_462_643_${i},")
+    endif()
+    flush_text(${i})
+  endforeach()
+  string(APPEND text "\n]\n")
+elseif(BENCH_SHAPE STREQUAL "aot")
+  foreach(i RANGE ${last})
+    string(APPEND text "[[items]]\nid = ${i}\nname = \"item ${i}\"\nweight = ${i}.5\nenabled = true\n")
+    string(APPEND text "tags = [\"a\", \"b\", \"c\"]\n\n")
+    flush_text(${i})
+  endforeach()
+elseif(BENCH_SHAPE STREQUAL "long_string")
+  string(REPEAT "lorem ipsum dolor sit amet, " 146 filler)
+  foreach(i RANGE ${last})
+    string(APPEND text "text_${i} = \"${i}: ${filler}\\tend\"\n")
+    string(APPEND text "block_${i} = '''\n${filler}\n${filler}'''\n")
+    flush_text(${i})
+  endforeach()
+else()
+  message(FATAL_ERROR "Unknown benchmark shape: ${BENCH_SHAPE}")
+endif()
+
+file(APPEND "${case_toml}" "${text}")
+
+file(READ "${case_toml}" BENCH_TOML)
+file(GLOB entry_templates "${BENCH_TEMPLATE_DIR}/*.cpp.in")
+foreach(entry_template IN LISTS entry_templates)
+  get_filename_component(entry_name "${entry_template}" NAME_WLE)
+  configure_file("${entry_template}" "${BENCH_OUTPUT_DIR}/${entry_name}" @ONLY)
+endforeach()
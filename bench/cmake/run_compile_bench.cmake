@@ -0,0 +1,77 @@
+if(NOT DEFINED BENCH_SOURCE)
+  message(FATAL_ERROR "BENCH_SOURCE is required")
+endif()
+if(NOT DEFINED BENCH_CASE)
+  message(FATAL_ERROR "BENCH_CASE is required")
+endif()
+if(NOT DEFINED BENCH_REPORT)
+  message(FATAL_ERROR "BENCH_REPORT is required")
+endif()
+if(NOT DEFINED CXX)
+  message(FATAL_ERROR "CXX is required")
+endif()
+if(NOT DEFINED CXX_STANDARD)
+  message(FATAL_ERROR "CXX_STANDARD is required")
+endif()
+if(NOT DEFINED PROJECT_INCLUDE_DIR)
+  message(FATAL_ERROR "PROJECT_INCLUDE_DIR is required")
+endif()
+if(NOT DEFINED BENCH_REPEAT)
+  set(BENCH_REPEAT 3)
+endif()
+
+set(flag_list "")
+if(DEFINED CXX_FLAGS AND NOT CXX_FLAGS STREQUAL "")
+  separate_arguments(flag_list NATIVE_COMMAND "${CXX_FLAGS}")
+endif()
+
+get_filename_component(entry_name "${BENCH_SOURCE}" NAME_WE)
+
+# Peak RSS comes from the system `time` utility when it is available; the column is left empty otherwise.
+find_program(time_program NAMES time PATHS /usr/bin NO_DEFAULT_PATH)
+set(time_prefix "")
+if(time_program)
+  if(CMAKE_HOST_APPLE)
+    set(time_prefix "${time_program}" -l)
+    set(rss_regex "([0-9]+)[ \t]+maximum resident set size")
+    set(rss_divisor 1024)
+  else()
+    set(time_prefix "${time_program}" -v)
+    set(rss_regex "Maximum resident set size \\(kbytes\\): ([0-9]+)")
+    set(rss_divisor 1)
+  endif()
+endif()
+
+set(best_us "")
+set(peak_rss_kb "")
+foreach(run RANGE 1 ${BENCH_REPEAT})
+  string(TIMESTAMP start_us "%s%f" UTC)
+  execute_process(
+    COMMAND ${time_prefix} "${CXX}" "-std=c++${CXX_STANDARD}" -fsyntax-only ${flag_list} "-I${PROJECT_INCLUDE_DIR}"
+      "${BENCH_SOURCE}"
+    RESULT_VARIABLE compile_rv
+    OUTPUT_VARIABLE compile_out
+    ERROR_VARIABLE compile_err
+  )
+  string(TIMESTAMP stop_us "%s%f" UTC)
+  if(NOT compile_rv EQUAL 0)
+    message(FATAL_ERROR "Benchmark source failed to compile: ${BENCH_SOURCE}\n${compile_err}")
+  endif()
+  math(EXPR elapsed_us "${stop_us} - ${start_us}")
+  if(best_us STREQUAL "" OR elapsed_us LESS best_us)
+    set(best_us ${elapsed_us})
+  endif()
+  if(time_program AND compile_err MATCHES "${rss_regex}")
+    math(EXPR rss_kb "${CMAKE_MATCH_1} / ${rss_divisor}")
+    if(peak_rss_kb STREQUAL "" OR rss_kb GREATER peak_rss_kb)
+      set(peak_rss_kb ${rss_kb})
+    endif()
+  endif()
+endforeach()
+
+math(EXPR best_ms "${best_us} / 1000")
+if(NOT EXISTS "${BENCH_REPORT}")
+  file(WRITE "${BENCH_REPORT}" "case,entry,best_ms,peak_rss_kb,runs\n")
+endif()
+file(APPEND "${BENCH_REPORT}" "${BENCH_CASE},${entry_name},${best_ms},${peak_rss_kb},${BENCH_REPEAT}\n")
+message(STATUS "${BENCH_CASE}/${entry_name}: ${best_ms} ms, ${peak_rss_kb} KiB peak RSS (best of ${BENCH_REPEAT})")
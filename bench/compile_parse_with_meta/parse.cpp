@@ -0,0 +1,9 @@
+#include "toml26/toml.hpp"
+
+constexpr auto cfg = toml::parseEmbed<
+#embed "case.toml"
+>();
+
+static_assert(cfg.version == 3);
+
+auto main() -> int {}
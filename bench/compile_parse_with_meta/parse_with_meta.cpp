@@ -0,0 +1,10 @@
+#include "toml26/toml.hpp"
+
+constexpr auto parsed = toml::parseEmbedWithMeta<
+#embed "case.toml"
+>();
+
+static_assert(parsed.data.version == 3);
+static_assert(parsed.meta.global.entryCount > 0);
+
+auto main() -> int {}
@@ -0,0 +1,10 @@
+#include "toml26/toml.hpp"
+
+constexpr auto cfg = toml::parseEmbed<
+#embed "case.toml"
+>();
+
+static_assert(cfg.crc_table.size() == 4096);
+static_assert(cfg.crc_table.get<4095>() == 38479);
+
+auto main() -> int {}
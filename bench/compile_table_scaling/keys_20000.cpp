@@ -0,0 +1,11 @@
+#include "toml26/toml.hpp"
+
+#include "table_source.hpp"
+
+static constexpr auto sourceBytes = bench::makeTableSource<20000>();
+
+constexpr auto cfg = toml::parseEmbed<sourceBytes>();
+
+static_assert(cfg.table.key_19999 == 19999);
+
+auto main() -> int {}
@@ -0,0 +1,41 @@
+#ifndef TOML26_BENCH_TABLE_SOURCE_HPP
+#define TOML26_BENCH_TABLE_SOURCE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string>
+
+namespace bench {
+constexpr auto appendNumber(std::string& out, std::size_t value) -> void {
+  auto const start = out.size();
+  do {
+    out.push_back(static_cast<char>('0' + value % 10));
+    value /= 10;
+  } while (value != 0);
+  std::reverse(out.begin() + static_cast<std::ptrdiff_t>(start), out.end());
+}
+
+consteval auto makeTableText(std::size_t keys) -> std::string {
+  auto out = std::string{"[table]\n"};
+  for (std::size_t i = 0; i < keys; ++i) {
+    out += "key_";
+    appendNumber(out, i);
+    out += " = ";
+    appendNumber(out, i);
+    out += '\n';
+  }
+  return out;
+}
+
+template<std::size_t Keys>
+consteval auto makeTableSource() {
+  constexpr auto size = makeTableText(Keys).size();
+  auto const     text = makeTableText(Keys);
+  auto           out  = std::array<char, size>{};
+  std::ranges::copy(text, out.begin());
+  return out;
+}
+}  // namespace bench
+
+#endif
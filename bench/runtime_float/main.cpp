@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <print>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "toml26/toml.hpp"
+
+constexpr std::size_t rounds = 5;
+
+auto makeTokens(std::size_t count, int precision) -> std::vector<std::string> {
+  auto state  = std::uint64_t{0x9E3779B97F4A7C15ULL};
+  auto tokens = std::vector<std::string>{};
+  tokens.reserve(count);
+  auto buffer = std::array<char, 64>{};
+  while (tokens.size() < count) {
+    state ^= state << 13U;
+    state ^= state >> 7U;
+    state ^= state << 17U;
+    auto const value  = std::bit_cast<double>((state >> 12U) | 0x3FF0000000000000ULL) * 1e3;
+    auto*      first  = buffer.data();
+    auto*      last   = buffer.data() + buffer.size();
+    auto const result = precision < 0 ? std::to_chars(first, last, value)
+                                      : std::to_chars(first, last, value, std::chars_format::general, precision);
+    tokens.emplace_back(first, result.ptr);
+  }
+  return tokens;
+}
+
+auto reportTokens(std::string_view name, std::vector<std::string> const& tokens) -> void {
+  auto bytes = std::size_t{0};
+  for (auto const& token: tokens) {
+    bytes += token.size();
+  }
+  auto best = 0.0;
+  auto sink = 0.0;
+  for (std::size_t r = 0; r < rounds; ++r) {
+    auto const start = std::chrono::steady_clock::now();
+    for (auto const& token: tokens) {
+      auto value = 0.0;
+      toml::detail::parseFloat64(token, value);
+      sink += value;
+    }
+    auto const stop = std::chrono::steady_clock::now();
+    auto const ms   = std::chrono::duration<double, std::milli>(stop - start).count();
+    best            = (r == 0) ? ms : std::min(best, ms);
+  }
+  if (sink == 0.0) {
+    std::println("unexpected zero sum");
+  }
+  std::println("{},{},{:.3f},{:.1f}", name, bytes, best, static_cast<double>(bytes) / (best * 1000.0));
+}
+
+auto reportDocument(std::string_view name, std::vector<std::string> const& tokens) -> void {
+  auto input = std::string{"values = [\n"};
+  for (auto const& token: tokens) {
+    input += token;
+    input += ",\n";
+  }
+  input += "]\n";
+  auto best = 0.0;
+  auto sink = std::size_t{0};
+  for (std::size_t r = 0; r < rounds; ++r) {
+    auto const start = std::chrono::steady_clock::now();
+    auto const doc   = toml::parse_runtime(input);
+    auto const stop  = std::chrono::steady_clock::now();
+    sink += doc["values"].sizeOf(doc["values"].ptr);
+    auto const ms = std::chrono::duration<double, std::milli>(stop - start).count();
+    best          = (r == 0) ? ms : std::min(best, ms);
+  }
+  if (sink == 0) {
+    std::println("unexpected empty document");
+  }
+  std::println("{},{},{:.3f},{:.1f}", name, input.size(), best, static_cast<double>(input.size()) / (best * 1000.0));
+}
+
+auto main() -> int {
+  auto const shortest = makeTokens(1'000'000, -1);
+  auto const long17   = makeTokens(1'000'000, 17);
+  std::println("input,bytes,best_ms,mb_per_s");
+  reportTokens("tokens_shortest", shortest);
+  reportTokens("tokens_17_digits", long17);
+  reportDocument("array_shortest", shortest);
+}
@@ -0,0 +1,75 @@
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <meta>
+#include <print>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr auto cfg = toml::parseEmbed<sourceBytes>();
+
+constexpr std::size_t rounds = 2000;
+
+template<typename Table>
+auto linearLookup(Table const& table, std::string_view key) -> toml::ValueRef {
+  using Rep          = Table::UnderlyingRep;
+  auto           out = toml::ValueRef{};
+  std::size_t    i   = 0;
+  constexpr auto ctx = std::meta::access_context::current();
+  template for (constexpr auto m: std::define_static_array(std::meta::nonstatic_data_members_of(^^Rep, ctx))) {
+    if (!out.valid() && i < Table::keyNames.size() && Table::keyNames[i] == key) {
+      out = toml::ValueRef::from(table.[:m:]);
+    }
+    ++i;
+  }
+  return out;
+}
+
+template<typename Table>
+auto lookupKeys() -> std::vector<std::string> {
+  auto out = std::vector<std::string>{};
+  for (std::size_t i = 0; i < Table::keyNames.size(); ++i) {
+    out.emplace_back(Table::keyNames[(i * 7 + 3) % Table::keyNames.size()]);
+  }
+  out.emplace_back("missing_key");
+  return out;
+}
+
+template<typename Table, typename Lookup>
+auto measure(Table const& table, std::vector<std::string> const& keys, Lookup lookup) -> double {
+  auto sink  = std::uint64_t{0};
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t r = 0; r < rounds; ++r) {
+    for (auto const& key: keys) {
+      sink += static_cast<std::uint64_t>(lookup(table, key).type);
+    }
+  }
+  auto stop = std::chrono::steady_clock::now();
+  if (sink == 0) {
+    std::println("unexpected empty lookups");
+  }
+  auto const total = std::chrono::duration<double, std::nano>(stop - start).count();
+  return total / static_cast<double>(rounds * keys.size());
+}
+
+template<typename Table>
+auto report(std::string_view name, Table const& table) -> void {
+  auto const keys   = lookupKeys<Table>();
+  auto const hashed = measure(table, keys, [](Table const& t, std::string_view key) { return t.lookupKey(key); });
+  auto const linear = measure(table, keys, [](Table const& t, std::string_view key) { return linearLookup(t, key); });
+  std::println("{},{},{:.2f},{:.2f}", name, Table::keyNames.size(), hashed, linear);
+}
+
+auto main() -> int {
+  std::println("table,keys,hashed_ns,linear_ns");
+  report("narrow", cfg.narrow);
+  report("wide", cfg.wide);
+}
@@ -0,0 +1,55 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <print>
+#include <string>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr std::size_t rounds = 5;
+
+auto makeInput(std::size_t services) -> std::string {
+  auto const block = std::string_view{sourceBytes.data(), sourceBytes.size()};
+  auto       out   = std::string{};
+  out.reserve(services * (block.size() + 24));
+  for (std::size_t i = 0; i < services; ++i) {
+    out += "[service_";
+    out += std::to_string(i);
+    out += "]\n";
+    out += block;
+    out += '\n';
+  }
+  return out;
+}
+
+auto report(std::string_view name, std::size_t services) -> void {
+  auto const input = makeInput(services);
+  auto       best  = 0.0;
+  auto       sink  = std::uint64_t{0};
+  for (std::size_t r = 0; r < rounds; ++r) {
+    auto const start = std::chrono::steady_clock::now();
+    auto const doc   = toml::parse_runtime(input);
+    auto const stop  = std::chrono::steady_clock::now();
+    sink += static_cast<std::uint64_t>(doc["service_0"]["port"].as<std::int64_t>());
+    auto const ms = std::chrono::duration<double, std::milli>(stop - start).count();
+    best          = (r == 0) ? ms : std::min(best, ms);
+  }
+  if (sink == 0) {
+    std::println("unexpected empty document");
+  }
+  auto const mbPerSecond = static_cast<double>(input.size()) / (best * 1000.0);
+  std::println("{},{},{:.3f},{:.1f}", name, input.size(), best, mbPerSecond);
+}
+
+auto main() -> int {
+  std::println("input,bytes,best_ms,mb_per_s");
+  report("services_256", 256);
+  report("services_16384", 16384);
+}
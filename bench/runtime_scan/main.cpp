@@ -0,0 +1,83 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <print>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr std::size_t rounds      = 5;
+constexpr std::size_t targetBytes = std::size_t{64} << 20;
+
+auto makeInput() -> std::string {
+  auto const block = std::string_view{sourceBytes.data(), sourceBytes.size()};
+  auto       out   = std::string{};
+  out.reserve(targetBytes + block.size());
+  while (out.size() < targetBytes) {
+    out += block;
+  }
+  return out;
+}
+
+auto reportScan(toml::scan_detail::ScanPath path, std::string_view input) -> void {
+  auto const kernel = toml::scan_detail::scanKernel(path);
+  auto const blocks = input.size() / toml::scan_detail::blockBytes;
+  auto       masks  = std::vector<toml::scan_detail::BlockMasks>(toml::scan_detail::StructuralIndex::windowBlocks);
+  auto       best   = 0.0;
+  auto       sink   = std::uint64_t{0};
+  for (std::size_t r = 0; r < rounds; ++r) {
+    auto const start = std::chrono::steady_clock::now();
+    for (std::size_t b = 0; b < blocks; b += masks.size()) {
+      auto const count = std::min(masks.size(), blocks - b);
+      kernel(input.data() + b * toml::scan_detail::blockBytes, count, masks.data());
+      sink += masks[count - 1].structural;
+    }
+    auto const stop = std::chrono::steady_clock::now();
+    auto const ms   = std::chrono::duration<double, std::milli>(stop - start).count();
+    best            = (r == 0) ? ms : std::min(best, ms);
+  }
+  if (sink == 0) {
+    std::println("unexpected empty index");
+  }
+  auto const gbPerSecond = static_cast<double>(blocks * toml::scan_detail::blockBytes) / (best * 1e6);
+  std::println("scan,{},{},{:.3f},{:.2f}", toml::scan_detail::scanPathName(path), input.size(), best, gbPerSecond);
+}
+
+auto reportValidate(toml::scan_detail::ScanPath path, std::string_view input) -> void {
+  auto const checker = toml::scan_detail::sourceChecker(path);
+  auto       best    = 0.0;
+  auto       sink    = std::uint64_t{0};
+  for (std::size_t r = 0; r < rounds; ++r) {
+    auto const start = std::chrono::steady_clock::now();
+    auto const check = checker(input);
+    auto const stop  = std::chrono::steady_clock::now();
+    sink += check.malformedUtf8 || check.loneCarriageReturn ? 0 : 1;
+    auto const ms = std::chrono::duration<double, std::milli>(stop - start).count();
+    best          = (r == 0) ? ms : std::min(best, ms);
+  }
+  if (sink == 0) {
+    std::println("unexpected invalid input");
+  }
+  auto const gbPerSecond = static_cast<double>(input.size()) / (best * 1e6);
+  std::println("validate,{},{},{:.3f},{:.2f}", toml::scan_detail::scanPathName(path), input.size(), best, gbPerSecond);
+}
+
+auto main() -> int {
+  auto const input = makeInput();
+  std::println("stage,path,bytes,best_ms,gb_per_s");
+  for (auto const path: {toml::scan_detail::ScanPath::scalar, toml::scan_detail::ScanPath::sse42,
+                         toml::scan_detail::ScanPath::avx2}) {
+    if (toml::scan_detail::isScanPathSupported(path)) {
+      reportScan(path, input);
+      reportValidate(path, input);
+    }
+  }
+}
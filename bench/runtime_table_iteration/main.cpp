@@ -0,0 +1,62 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <print>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+#include "../compile_table_scaling/table_source.hpp"
+
+static constexpr auto smallSource = bench::makeTableSource<1000>();
+static constexpr auto largeSource = bench::makeTableSource<10000>();
+
+constexpr auto smallCfg = toml::parseEmbed<smallSource>();
+constexpr auto largeCfg = toml::parseEmbed<largeSource>();
+
+constexpr std::size_t rounds = 200;
+
+auto countEntry(void* context, std::string_view key, toml::ValueRef const& value) -> void {
+  *static_cast<std::uint64_t*>(context) += key.size() + static_cast<std::uint64_t>(value.type);
+}
+
+template<typename Body>
+auto measure(std::size_t keys, Body body) -> double {
+  auto sink  = std::uint64_t{0};
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t r = 0; r < rounds; ++r) {
+    sink += body();
+  }
+  auto stop = std::chrono::steady_clock::now();
+  if (sink == 0) {
+    std::println("unexpected empty table");
+  }
+  auto const total = std::chrono::duration<double, std::nano>(stop - start).count();
+  return total / static_cast<double>(rounds * keys);
+}
+
+template<typename Table>
+auto report(std::string_view name, Table const& table) -> void {
+  auto const keys    = Table::keyNames.size();
+  auto const rangeNs = measure(keys, [&] {
+    auto sink = std::uint64_t{0};
+    for (auto const entry: table) {
+      sink += entry.key.size() + static_cast<std::uint64_t>(entry.value.type);
+    }
+    return sink;
+  });
+  auto const visitNs = measure(keys, [&] {
+    auto       sink  = std::uint64_t{0};
+    auto const value = toml::ValueRef::from(table);
+    value.forEachKeyValue(value.ptr, &sink, &countEntry);
+    return sink;
+  });
+  auto const jsonNs  = measure(keys, [&] { return static_cast<std::uint64_t>(toml::json_size(table)); });
+  std::println("{},{},{:.2f},{:.2f},{:.2f}", name, keys, rangeNs, visitNs, jsonNs);
+}
+
+auto main() -> int {
+  std::println("table,keys,range_for_ns,for_each_key_value_ns,json_size_ns");
+  report("keys_1000", smallCfg.table);
+  report("keys_10000", largeCfg.table);
+}
@@ -0,0 +1,70 @@
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <print>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr auto cfg = toml::parseEmbed<sourceBytes>();
+
+constexpr std::size_t rounds = 200000;
+
+auto countEntry(void* context, std::string_view key, toml::ValueRef const& value) -> void {
+  *static_cast<std::uint64_t*>(context) += key.size() + static_cast<std::uint64_t>(value.type);
+}
+
+// Visits every key of `table` and every element of `array` through the handle's operations.
+auto iterate(toml::ValueRef table, toml::ValueRef array) -> std::uint64_t {
+  auto sink = std::uint64_t{0};
+  table.forEachKeyValue(table.ptr, &sink, &countEntry);
+  auto const count = array.sizeOf(array.ptr);
+  for (std::size_t i = 0; i < count; ++i) {
+    sink += static_cast<std::uint64_t>(array.lookupByIndex(array.ptr, i).type);
+  }
+  return sink;
+}
+
+// Nine chained `operator[]` steps, each producing a fresh handle from the previous one.
+auto deepLookup(toml::ValueRef root) -> std::uint64_t {
+  auto const leaf = root["deep"]["l1"]["l2"]["l3"]["l4"]["l5"]["l6"]["l7"]["values"][std::size_t{63}];
+  return static_cast<std::uint64_t>(leaf.type);
+}
+
+template<typename Body>
+auto measure(Body body) -> double {
+  auto sink  = std::uint64_t{0};
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t r = 0; r < rounds; ++r) {
+    sink += body();
+  }
+  auto stop = std::chrono::steady_clock::now();
+  if (sink == 0) {
+    std::println("unexpected empty traversal");
+  }
+  return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(rounds);
+}
+
+auto report(std::string_view name, toml::ValueRef root) -> void {
+  auto const table   = root["flat"];
+  auto const array   = root["deep"]["l1"]["l2"]["l3"]["l4"]["l5"]["l6"]["l7"]["values"];
+  auto const iterNs  = measure([&] { return iterate(table, array); });
+  auto const deepNs  = measure([&] { return deepLookup(root); });
+  auto       entries = array.sizeOf(array.ptr);
+  table.forEachKeyValue(table.ptr, &entries, [](void* context, std::string_view, toml::ValueRef const&) {
+    ++*static_cast<std::size_t*>(context);
+  });
+  std::println("{},{},{},{:.2f},{:.2f}", name, sizeof(toml::ValueRef), entries, iterNs, deepNs);
+}
+
+auto main() -> int {
+  auto const doc = toml::parse_runtime(std::string_view{sourceBytes.data(), sourceBytes.size()});
+  std::println("document,handle_bytes,entries,iterate_ns,deep_lookup_ns");
+  report("compile_time", toml::ValueRef::from(cfg));
+  report("runtime", doc.root());
+}
@@ -0,0 +1,172 @@
+#ifndef TOML26_BIND_HPP
+#define TOML26_BIND_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <meta>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace toml {
+namespace bind_detail {
+template<typename T>
+struct IsOptional: std::false_type {};
+
+template<typename T>
+struct IsOptional<std::optional<T>>: std::true_type {};
+
+template<typename T>
+struct IsStdArray: std::false_type {};
+
+template<typename T, std::size_t N>
+struct IsStdArray<std::array<T, N>>: std::true_type {};
+
+template<typename Node>
+concept ArrayNode = requires { typename Node::TomlArrayTag; };
+
+template<typename Node>
+concept TableNode = !ArrayNode<Node> && requires { Node::keyNames; };
+
+consteval auto keyPath(std::string const& prefix, std::string_view key) -> std::string {
+  auto out = prefix;
+  path_detail::appendPathKey(out, key);
+  return out;
+}
+
+consteval auto indexPath(std::string const& prefix, std::size_t index) -> std::string {
+  auto out = prefix;
+  path_detail::appendPathIndex(out, index);
+  return out;
+}
+
+consteval auto displayPath(std::string const& path) -> std::string { return path.empty() ? "the root" : path; }
+
+template<typename T>
+consteval auto hasMember(std::string_view name) -> bool {
+  for (auto const m: meta::nonstatic_data_members_of(^^T, meta::access_context::current())) {
+    if (meta::has_identifier(m) && meta::identifier_of(m) == name) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template<typename T, typename Node>
+consteval auto bindTable(Node const& node, std::string const& path) -> T;
+
+// One TOML value into a field of type `T`. Integers narrow only when the value fits, floats accept integers, strings
+// bind to `std::string_view` or `char const*`, arrays to `std::array` of the exact length, tables to aggregates.
+template<typename T, typename Node>
+consteval auto bindValue(Node const& node, std::string const& path) -> T {
+  using S = std::remove_cvref_t<Node>;
+  if constexpr (IsOptional<T>::value) {
+    return T{bindValue<typename T::value_type>(node, path)};
+  } else if constexpr (std::same_as<T, bool>) {
+    if constexpr (std::same_as<S, bool>) {
+      return node;
+    } else {
+      fail("parse_as: " + path + " is not a boolean");
+    }
+  } else if constexpr (std::integral<T>) {
+    if constexpr (std::same_as<S, std::int64_t>) {
+      if (!std::in_range<T>(node)) {
+        fail("parse_as: " + path + " is out of range for its field");
+      }
+      return static_cast<T>(node);
+    } else {
+      fail("parse_as: " + path + " is not an integer");
+    }
+  } else if constexpr (std::floating_point<T>) {
+    if constexpr (std::same_as<S, double> || std::same_as<S, std::int64_t>) {
+      return static_cast<T>(node);
+    } else {
+      fail("parse_as: " + path + " is not a number");
+    }
+  } else if constexpr (std::same_as<T, std::string_view> || std::same_as<T, char const*>) {
+    if constexpr (std::same_as<S, char const*>) {
+      return T{node};
+    } else {
+      fail("parse_as: " + path + " is not a string");
+    }
+  } else if constexpr (IsStdArray<T>::value) {
+    if constexpr (!ArrayNode<S>) {
+      fail("parse_as: " + path + " is not an array");
+    } else if constexpr (S::staticSize() != std::tuple_size_v<T>) {
+      fail("parse_as: " + path + " does not have as many elements as its field");
+    } else {
+      auto out = T{};
+      template for (constexpr auto i: S::indices()) {
+        out[i] = bindValue<typename T::value_type>(node.template get<i>(), indexPath(path, i));
+      }
+      return out;
+    }
+  } else if constexpr (std::same_as<T, S>) {
+    return node;
+  } else if constexpr (std::is_aggregate_v<T> && std::is_class_v<T>) {
+    if constexpr (TableNode<S>) {
+      return bindTable<T>(node, path);
+    } else {
+      fail("parse_as: " + displayPath(path) + " is not a table");
+    }
+  } else {
+    fail("parse_as: " + path + " cannot bind to its field type");
+  }
+}
+
+// Every field is matched by name. A missing key keeps the field's default member initializer (or `std::nullopt`);
+// a missing key without either, and a key with no matching field, are errors.
+template<typename T, typename Node>
+consteval auto bindTable(Node const& node, std::string const& path) -> T {
+  for (auto const key: Node::keyNames) {
+    if (!hasMember<T>(key)) {
+      fail("parse_as: unknown key " + keyPath(path, key));
+    }
+  }
+  auto           out = T{};
+  constexpr auto ctx = meta::access_context::current();
+  template for (constexpr auto m: define_static_array(nonstatic_data_members_of(^^T, ctx))) {
+    using Field             = [:type_of(m):];
+    constexpr auto position = path_detail::keyPosition<Node>(identifier_of(m));
+    if constexpr (position < Node::keyNames.size()) {
+      out.[:m:] = bindValue<Field>(node.template get<position>(), keyPath(path, identifier_of(m)));
+    } else if constexpr (!IsOptional<Field>::value && !meta::has_default_member_initializer(m)) {
+      fail("parse_as: missing key " + keyPath(path, identifier_of(m)));
+    }
+  }
+  return out;
+}
+}  // namespace bind_detail
+
+// Parses `Source` and binds it into the user aggregate `T` in one constant evaluation, so only `T` (laid out as
+// declared, no `ValueRef` or generated members) reaches the program. Name, type and range errors are compile errors
+// naming the offending path.
+template<typename T, FixedString Source>
+consteval auto parse_as() -> T {
+  static_assert(std::is_aggregate_v<T>, "parse_as: target type must be an aggregate");
+  return bind_detail::bindTable<T>(parse<Source>(), std::string{});
+}
+
+template<typename T, auto SourceBytes>
+consteval auto parse_as() -> T {
+  static_assert(std::is_aggregate_v<T>, "parse_as: target type must be an aggregate");
+  return bind_detail::bindTable<T>(parse<SourceBytes>(), std::string{});
+}
+
+template<typename T, auto SourceBytes>
+consteval auto parseEmbedAs() -> T {
+  return parse_as<T, SourceBytes>();
+}
+
+template<typename T, int... Bytes>
+consteval auto parseEmbedAs() -> T {
+  constexpr auto sourceBytes = detail::makeEmbeddedArray<Bytes...>();
+  return parse_as<T, sourceBytes>();
+}
+}  // namespace toml
+
+#endif
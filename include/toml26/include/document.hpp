@@ -0,0 +1,938 @@
+#ifndef TOML26_DOCUMENT_HPP
+#define TOML26_DOCUMENT_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "scan.hpp"
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define TOML26_HAS_MMAP 1
+#else
+#define TOML26_HAS_MMAP 0
+#endif
+
+namespace toml {
+namespace runtime_detail {
+struct Node;
+
+struct Entry {
+  std::string_view key{};
+  Node*            value = nullptr;
+};
+
+struct Children {
+  std::pmr::vector<Entry>         entries;
+  std::pmr::vector<std::uint32_t> index;
+
+  explicit Children(std::pmr::memory_resource* arena): entries(arena), index(arena) {}
+};
+
+struct StringValue {
+  char const* data = nullptr;
+  std::size_t size = 0;
+};
+
+struct Node {
+  ValueType type           = ValueType::none;
+  bool      inlineTable    = false;
+  bool      explicitHeader = false;
+  bool      dottedDefined  = false;
+  bool      arrayOfTables  = false;
+
+  union Scalar {
+    StringValue    string{};
+    std::int64_t   integer;
+    double         floating;
+    bool           boolean;
+    OffsetDateTime offsetDateTime;
+    LocalDateTime  localDateTime;
+    LocalDate      localDate;
+    LocalTime      localTime;
+    Children*      children;
+  } scalar{};
+};
+
+inline constexpr std::size_t indexedEntryThreshold = 8;
+
+inline auto findEntry(Node const& node, std::string_view key) -> Node* {
+  auto const& table = *node.scalar.children;
+  if (table.index.empty()) {
+    for (auto const& entry: table.entries) {
+      if (entry.key == key) {
+        return entry.value;
+      }
+    }
+    return nullptr;
+  }
+  auto const mask = table.index.size() - 1;
+  auto       slot = static_cast<std::size_t>(hash_detail::hashKey(key)) & mask;
+  while (table.index[slot] != 0) {
+    auto const& entry = table.entries[table.index[slot] - 1];
+    if (entry.key == key) {
+      return entry.value;
+    }
+    slot = (slot + 1) & mask;
+  }
+  return nullptr;
+}
+
+inline auto placeEntry(Children& table, std::size_t position) -> void {
+  auto const mask = table.index.size() - 1;
+  auto       slot = static_cast<std::size_t>(hash_detail::hashKey(table.entries[position].key)) & mask;
+  while (table.index[slot] != 0) {
+    slot = (slot + 1) & mask;
+  }
+  table.index[slot] = static_cast<std::uint32_t>(position + 1);
+}
+
+inline auto insertEntry(Node& node, std::string_view key, Node* value) -> void {
+  auto& table = *node.scalar.children;
+  table.entries.push_back(Entry{key, value});
+  auto const count = table.entries.size();
+  if (count <= indexedEntryThreshold) {
+    return;
+  }
+  if (count * 2 <= table.index.size()) {
+    placeEntry(table, count - 1);
+    return;
+  }
+  table.index.assign(std::bit_ceil(count * 4), 0);
+  for (std::size_t i = 0; i < count; ++i) {
+    placeEntry(table, i);
+  }
+}
+
+inline auto valueRefOf(Node const& node) -> ValueRef;
+
+inline auto lookupKey(void const* p, std::string_view key) -> ValueRef {
+  auto const* value = findEntry(*static_cast<Node const*>(p), key);
+  return value == nullptr ? ValueRef{} : valueRefOf(*value);
+}
+
+inline auto lookupIndex(void const* p, std::size_t idx) -> ValueRef {
+  auto const& elements = static_cast<Node const*>(p)->scalar.children->entries;
+  return idx < elements.size() ? valueRefOf(*elements[idx].value) : ValueRef{};
+}
+
+inline auto sizeOfString(void const* p) -> std::size_t { return static_cast<StringValue const*>(p)->size; }
+
+inline auto sizeOfArray(void const* p) -> std::size_t {
+  return static_cast<Node const*>(p)->scalar.children->entries.size();
+}
+
+inline auto forEachEntry(void const* p, void* context, ValueRef::EmitKeyValueCallback emit) -> void {
+  for (auto const& entry: static_cast<Node const*>(p)->scalar.children->entries) {
+    emit(context, entry.key, valueRefOf(*entry.value));
+  }
+}
+
+inline constexpr auto stringOps = ValueOps{nullptr, nullptr, &sizeOfString, nullptr};
+inline constexpr auto arrayOps  = ValueOps{nullptr, &lookupIndex, &sizeOfArray, nullptr};
+inline constexpr auto tableOps  = ValueOps{&lookupKey, nullptr, nullptr, &forEachEntry};
+
+inline auto valueRefOf(Node const& node) -> ValueRef {
+  auto const& s = node.scalar;
+  switch (node.type) {
+  case ValueType::string        : return ValueRef{node.type, &s.string, &stringOps};
+  case ValueType::integer       : return ValueRef{node.type, &s.integer};
+  case ValueType::floating      : return ValueRef{node.type, &s.floating};
+  case ValueType::boolean       : return ValueRef{node.type, &s.boolean};
+  case ValueType::offsetDateTime: return ValueRef{node.type, &s.offsetDateTime};
+  case ValueType::localDateTime : return ValueRef{node.type, &s.localDateTime};
+  case ValueType::localDate     : return ValueRef{node.type, &s.localDate};
+  case ValueType::localTime     : return ValueRef{node.type, &s.localTime};
+  case ValueType::array         : return ValueRef{node.type, &node, &arrayOps};
+  case ValueType::table         : return ValueRef{node.type, &node, &tableOps};
+  default                       : return ValueRef{};
+  }
+}
+
+inline constexpr std::size_t arenaBytesPerSourceByte  = 8;
+inline constexpr std::size_t minimumArenaBytes        = 4096;
+inline constexpr std::size_t maximumInitialArenaBytes = std::size_t{64} << 20;
+
+struct MappedFile {
+  void*       address = nullptr;
+  std::size_t length  = 0;
+
+  MappedFile() = default;
+  MappedFile(MappedFile const&)                    = delete;
+  auto operator=(MappedFile const&) -> MappedFile& = delete;
+
+  ~MappedFile() {
+#if TOML26_HAS_MMAP
+    if (address != nullptr) {
+      ::munmap(address, length);
+    }
+#endif
+  }
+
+  auto bytes() const -> std::string_view { return {static_cast<char const*>(address), length}; }
+};
+}  // namespace runtime_detail
+
+struct Document {
+  using TomlDocumentTag = void;
+
+  std::unique_ptr<std::pmr::monotonic_buffer_resource> arena{};
+  std::string_view                                     source{};
+  runtime_detail::Node const*                          rootNode = nullptr;
+  std::unique_ptr<runtime_detail::MappedFile>          mapping{};
+
+  auto root() const -> ValueRef { return rootNode == nullptr ? ValueRef{} : runtime_detail::valueRefOf(*rootNode); }
+
+  auto operator[](std::string_view key) const -> ValueRef { return root()[key]; }
+
+  template<path_detail::PathSegment First, path_detail::PathSegment... Rest>
+  requires(sizeof...(Rest) > 0)
+  auto operator[](First first, Rest... rest) const -> ValueRef {
+    return root()[first, rest...];
+  }
+
+  template<typename T>
+  auto at(std::string_view key) const -> T {
+    return root().at<T>(key);
+  }
+
+  template<typename T>
+  auto at_or(std::string_view key, T defaultValue) const -> T {
+    return root().at_or<T>(key, defaultValue);
+  }
+
+  template<typename T, path_detail::PathSegment First, path_detail::PathSegment... Rest>
+  auto find(First first, Rest... rest) const -> std::optional<T> {
+    return root().find<T>(first, rest...);
+  }
+};
+
+namespace runtime_detail {
+struct TreeBuilder {
+  struct Frame {
+    Node*            node   = nullptr;
+    Node*            target = nullptr;
+    std::string_view leaf{};
+  };
+
+  std::string_view           source{};
+  std::pmr::memory_resource* arena{};
+  Node*                      root    = nullptr;
+  Node*                      current = nullptr;
+  Node*                      target  = nullptr;
+  std::string_view           leaf{};
+  std::pmr::vector<Frame>    frames{arena};
+
+  auto newNode(ValueType type) -> Node* {
+    auto alloc = std::pmr::polymorphic_allocator<>{arena};
+    auto* node = alloc.new_object<Node>();
+    node->type = type;
+    if (type == ValueType::array || type == ValueType::table) {
+      node->scalar.children = alloc.new_object<Children>(arena);
+    }
+    return node;
+  }
+
+  auto keep(std::string_view text) -> std::string_view {
+    auto* chars = static_cast<char*>(arena->allocate(text.size() + 1, alignof(char)));
+    std::ranges::copy(text, chars);
+    chars[text.size()] = '\0';
+    return std::string_view{chars, text.size()};
+  }
+
+  auto begin() -> void { root = current = newNode(ValueType::table); }
+
+  auto statement() -> void {}
+
+  auto descend(Node& table, std::string_view key, bool fromHeader) -> Node* {
+    auto* child = findEntry(table, key);
+    if (child == nullptr) {
+      child                = newNode(ValueType::table);
+      child->dottedDefined = !fromHeader;
+      insertEntry(table, key, child);
+      return child;
+    }
+    if (child->type == ValueType::table && !child->inlineTable) {
+      child->dottedDefined = child->dottedDefined || !fromHeader;
+      return child;
+    }
+    if (child->type == ValueType::array && child->arrayOfTables) {
+      return child->scalar.children->entries.back().value;
+    }
+    return nullptr;
+  }
+
+  auto parentOf(std::span<std::string_view const> path, Node* from, bool fromHeader) -> Node* {
+    for (std::size_t i = 0; from != nullptr && i + 1 < path.size(); ++i) {
+      from = descend(*from, path[i], fromHeader);
+    }
+    return from;
+  }
+
+  auto table(std::span<std::string_view const> path) -> detail::ParseError {
+    auto* parent = parentOf(path, root, true);
+    if (parent == nullptr) {
+      return detail::ParseError::duplicateKey;
+    }
+    auto* child = findEntry(*parent, path.back());
+    if (child == nullptr) {
+      child = newNode(ValueType::table);
+      insertEntry(*parent, path.back(), child);
+    } else if (child->type != ValueType::table || child->inlineTable || child->explicitHeader
+               || child->dottedDefined) {
+      return detail::ParseError::duplicateKey;
+    }
+    child->explicitHeader = true;
+    current               = child;
+    return detail::ParseError::none;
+  }
+
+  auto arrayTable(std::span<std::string_view const> path) -> detail::ParseError {
+    auto* parent = parentOf(path, root, true);
+    if (parent == nullptr) {
+      return detail::ParseError::duplicateKey;
+    }
+    auto* child = findEntry(*parent, path.back());
+    if (child == nullptr) {
+      child                = newNode(ValueType::array);
+      child->arrayOfTables = true;
+      insertEntry(*parent, path.back(), child);
+    } else if (child->type != ValueType::array || !child->arrayOfTables) {
+      return detail::ParseError::duplicateKey;
+    }
+    auto* element           = newNode(ValueType::table);
+    element->explicitHeader = true;
+    child->scalar.children->entries.push_back(Entry{{}, element});
+    current = element;
+    return detail::ParseError::none;
+  }
+
+  auto key(std::span<std::string_view const> path) -> detail::ParseError {
+    auto* parent = parentOf(path, frames.empty() ? current : frames.back().node, false);
+    if (parent == nullptr || findEntry(*parent, path.back()) != nullptr) {
+      return detail::ParseError::duplicateKey;
+    }
+    if (frames.empty()) {
+      target = parent;
+      leaf   = path.back();
+    } else {
+      frames.back().target = parent;
+      frames.back().leaf   = path.back();
+    }
+    return detail::ParseError::none;
+  }
+
+  auto place(Node* node) -> void {
+    if (frames.empty()) {
+      insertEntry(*target, leaf, node);
+    } else if (auto& top = frames.back(); top.node->type == ValueType::array) {
+      top.node->scalar.children->entries.push_back(Entry{{}, node});
+    } else {
+      insertEntry(*top.target, top.leaf, node);
+    }
+  }
+
+  auto borrowsSource(StringValue const& text) const -> bool {
+    return text.data >= source.data() && text.data + text.size <= source.data() + source.size();
+  }
+
+  auto scalar(Node const& value) -> void {
+    auto* node = std::pmr::polymorphic_allocator<>{arena}.new_object<Node>(value);
+    if (value.type == ValueType::string && !borrowsSource(value.scalar.string)) {
+      auto const kept     = keep(std::string_view{value.scalar.string.data, value.scalar.string.size});
+      node->scalar.string = StringValue{kept.data(), kept.size()};
+    }
+    place(node);
+  }
+
+  auto beginArray() -> void { frames.push_back(Frame{newNode(ValueType::array)}); }
+
+  auto beginInlineTable() -> void { frames.push_back(Frame{newNode(ValueType::table)}); }
+
+  auto endArray() -> void {
+    auto* node = frames.back().node;
+    frames.pop_back();
+    place(node);
+  }
+
+  auto endInlineTable() -> void {
+    auto* node        = frames.back().node;
+    node->inlineTable = true;
+    frames.pop_back();
+    place(node);
+  }
+
+  auto comment(std::string_view) -> void {}
+};
+
+template<typename Sink>
+struct Grammar {
+  std::string_view                   src{};
+  Sink&                              sink;
+  std::pmr::memory_resource*         memory      = std::pmr::get_default_resource();
+  std::string_view                   context     = "parse_runtime";
+  std::size_t                        firstLine   = 1;
+  bool                               hasControls = true;
+  std::size_t                        pos         = 0;
+  std::pmr::vector<std::string_view> keyPath{memory};
+  std::pmr::string                   scratch{memory};
+  scan_detail::StructuralIndex       index{src};
+
+  [[noreturn]] auto error(detail::ParseError code) const -> void {
+    std::size_t line   = firstLine;
+    std::size_t column = 1;
+    for (std::size_t i = 0; i < pos && i < src.size(); ++i) {
+      if (src[i] == '\n') {
+        ++line;
+        column = 1;
+      } else {
+        ++column;
+      }
+    }
+    auto message = std::string{context};
+    message.append(": ");
+    message.append(detail::parseErrorCode(code));
+    message.append(" at line ");
+    message.append(std::to_string(line));
+    message.append(", column ");
+    message.append(std::to_string(column));
+    fail(std::move(message));
+  }
+
+  auto check(detail::ParseError code, std::size_t at) -> void {
+    if (code != detail::ParseError::none) {
+      pos = at;
+      error(code);
+    }
+  }
+
+  auto atEnd() const -> bool { return pos >= src.size(); }
+
+  auto peek() const -> char { return pos < src.size() ? src[pos] : '\0'; }
+
+  auto quotedText(std::size_t next, bool allowMultiline) -> std::string_view {
+    auto const token    = src.substr(pos, next - pos);
+    auto       borrowed = std::string_view{};
+    if (detail::borrowQuotedString(token, borrowed, allowMultiline)) {
+      return borrowed;
+    }
+    if (!detail::parseQuotedString(token, scratch, allowMultiline)) {
+      error(allowMultiline ? detail::ParseError::invalidString : detail::ParseError::invalidKey);
+    }
+    return scratch;
+  }
+
+  auto skipWs() -> void { pos = index.skipWhitespace(pos); }
+
+  auto skipComment() -> void {
+    if (peek() != '#') {
+      return;
+    }
+    auto i = index.nextStructural(pos + 1);
+    while (i < src.size() && !detail::isDisallowedCommentControl(src[i])) {
+      i = index.nextStructural(i + 1);
+    }
+    if (i < src.size() && src[i] != '\n' && src[i] != '\r') {
+      pos = i;
+      error(detail::ParseError::invalidComment);
+    }
+    sink.comment(src.substr(pos + 1, i - pos - 1));
+    pos = i;
+  }
+
+  auto skipNewline() -> bool {
+    if (peek() == '\n') {
+      ++pos;
+      return true;
+    }
+    if (peek() == '\r' && pos + 1 < src.size() && src[pos + 1] == '\n') {
+      pos += 2;
+      return true;
+    }
+    return false;
+  }
+
+  auto skipWsCommentsAndNewlines() -> void {
+    while (true) {
+      skipWs();
+      skipComment();
+      if (!skipNewline()) {
+        return;
+      }
+    }
+  }
+
+  // Inline tables may span lines but, as in the compile-time parser, must not contain comments.
+  auto skipWsAndNewlines() -> void {
+    do {
+      skipWs();
+    } while (skipNewline());
+  }
+
+  auto expectLineEnd() -> void {
+    skipWs();
+    skipComment();
+    if (!atEnd() && !skipNewline()) {
+      error(detail::ParseError::malformedLine);
+    }
+  }
+
+  auto scanQuoted(bool allowMultiline, std::size_t& next, bool& plain) -> bool {
+    auto const quote     = src[pos];
+    bool const multiline = pos + 2 < src.size() && src[pos + 1] == quote && src[pos + 2] == quote;
+    if (multiline && !allowMultiline) {
+      return false;
+    }
+    plain  = !multiline;
+    auto i = index.nextStructural(pos + (multiline ? 3U : 1U));
+    while (i < src.size()) {
+      auto const c = src[i];
+      if (!multiline && (c == '\n' || c == '\r')) {
+        return false;
+      }
+      if (quote == '"' && c == '\\') {
+        if (i + 1 >= src.size()) {
+          return false;
+        }
+        plain = false;
+        i     = index.nextStructural(i + 2);
+        continue;
+      }
+      if (c == quote && !multiline) {
+        next = i + 1;
+        return true;
+      }
+      if (c == quote) {
+        if (auto const end = detail::multilineStringEnd(src, i, quote); end != 0) {
+          next = end;
+          return true;
+        }
+      }
+      plain = plain && !(hasControls && detail::isDisallowedStringControl(c, false));
+      i     = index.nextStructural(i + 1);
+    }
+    return false;
+  }
+
+  auto scanQuotedText(bool allowMultiline) -> std::string_view {
+    std::size_t next  = 0;
+    bool        plain = false;
+    if (!scanQuoted(allowMultiline, next, plain)) {
+      error(allowMultiline ? detail::ParseError::invalidString : detail::ParseError::invalidKey);
+    }
+    auto const text = plain ? src.substr(pos + 1, next - pos - 2) : quotedText(next, allowMultiline);
+    pos             = next;
+    return text;
+  }
+
+  auto parseKeySegment() -> std::string_view {
+    auto const c = peek();
+    if (c == '"' || c == '\'') {
+      auto const key = scanQuotedText(false);
+      return key.data() == scratch.data() ? sink.keep(key) : key;
+    }
+    auto const start = pos;
+    while (!atEnd() && detail::isBareKeyChar(src[pos])) {
+      ++pos;
+    }
+    if (pos == start) {
+      error(detail::ParseError::invalidKey);
+    }
+    return src.substr(start, pos - start);
+  }
+
+  auto parseKeyPath() -> void {
+    keyPath.clear();
+    while (true) {
+      keyPath.push_back(parseKeySegment());
+      skipWs();
+      if (peek() != '.') {
+        return;
+      }
+      ++pos;
+      skipWs();
+    }
+  }
+
+  auto parseKeyValue() -> void {
+    auto const keyStart = pos;
+    parseKeyPath();
+    skipWs();
+    if (peek() != '=') {
+      pos = keyStart;
+      error(detail::ParseError::malformedLine);
+    }
+    ++pos;
+    skipWs();
+    check(sink.key(std::span<std::string_view const>{keyPath}), keyStart);
+    parseValue();
+  }
+
+  auto parseHeader() -> void {
+    auto const headerStart = pos;
+    ++pos;
+    bool const arrayHeader = peek() == '[';
+    if (arrayHeader) {
+      ++pos;
+    }
+    skipWs();
+    parseKeyPath();
+    skipWs();
+    if (peek() != ']' || (arrayHeader && (pos + 1 >= src.size() || src[pos + 1] != ']'))) {
+      error(detail::ParseError::malformedLine);
+    }
+    pos += arrayHeader ? 2 : 1;
+    auto const path = std::span<std::string_view const>{keyPath};
+    auto const code = arrayHeader ? sink.arrayTable(path) : sink.table(path);
+    expectLineEnd();
+    check(code, headerStart);
+  }
+
+  auto parseString() -> void {
+    auto const text    = scanQuotedText(true);
+    auto       node    = Node{ValueType::string};
+    node.scalar.string = StringValue{text.data(), text.size()};
+    sink.scalar(node);
+  }
+
+  auto scalarEnd(std::size_t from) -> std::size_t {
+    from = index.nextDelimiter(from);
+    while (from < src.size()) {
+      auto const c = src[from];
+      if (detail::isWs(c) || c == ',' || c == ']' || c == '}' || c == '#' || c == '\n' || c == '\r') {
+        break;
+      }
+      from = index.nextDelimiter(from + 1);
+    }
+    return from;
+  }
+
+  auto parseScalar() -> void {
+    auto const start = pos;
+    auto       end   = scalarEnd(pos);
+    if (end - start == 10 && src[start + 4] == '-' && src[start + 7] == '-' && end + 1 < src.size() && src[end] == ' '
+        && src[end + 1] >= '0' && src[end + 1] <= '9') {
+      end = scalarEnd(end + 1);
+    }
+    auto const raw = src.substr(start, end - start);
+    if (raw.empty()) {
+      error(detail::ParseError::unsupportedValue);
+    }
+    auto token = detail::ScalarToken{};
+    if (auto const code = detail::parseScalarToken(raw, token); code != detail::ParseError::none) {
+      error(code);
+    }
+    pos       = end;
+    auto node = Node{token.type};
+    auto& s   = node.scalar;
+    switch (token.type) {
+    case ValueType::boolean       : s.boolean = token.boolean; break;
+    case ValueType::integer       : s.integer = token.integer; break;
+    case ValueType::floating      : s.floating = token.floating; break;
+    case ValueType::localDate     : s.localDate = token.date; break;
+    case ValueType::localTime     : s.localTime = token.time; break;
+    case ValueType::localDateTime : s.localDateTime = LocalDateTime{token.date, token.time}; break;
+    case ValueType::offsetDateTime: s.offsetDateTime = OffsetDateTime{token.date, token.time, token.offsetMinutes}; break;
+    default                       : error(detail::ParseError::unsupportedValue);
+    }
+    sink.scalar(node);
+  }
+
+  auto parseArray() -> void {
+    ++pos;
+    sink.beginArray();
+    while (true) {
+      skipWsCommentsAndNewlines();
+      if (atEnd()) {
+        error(detail::ParseError::invalidArray);
+      }
+      if (peek() == ']') {
+        ++pos;
+        break;
+      }
+      if (peek() == ',') {
+        error(detail::ParseError::invalidArray);
+      }
+      parseValue();
+      skipWsCommentsAndNewlines();
+      if (peek() == ',') {
+        ++pos;
+      } else if (peek() == ']') {
+        ++pos;
+        break;
+      } else {
+        error(detail::ParseError::invalidArray);
+      }
+    }
+    sink.endArray();
+  }
+
+  auto parseInlineTable() -> void {
+    ++pos;
+    sink.beginInlineTable();
+    while (true) {
+      skipWsAndNewlines();
+      if (atEnd()) {
+        error(detail::ParseError::invalidInlineTable);
+      }
+      if (peek() == '}') {
+        ++pos;
+        break;
+      }
+      if (peek() == ',') {
+        error(detail::ParseError::invalidInlineTable);
+      }
+      parseKeyValue();
+      skipWsAndNewlines();
+      if (peek() == ',') {
+        ++pos;
+      } else if (peek() == '}') {
+        ++pos;
+        break;
+      } else {
+        error(detail::ParseError::invalidInlineTable);
+      }
+    }
+    sink.endInlineTable();
+  }
+
+  auto parseValue() -> void {
+    switch (peek()) {
+    case '"' :
+    case '\'': parseString(); break;
+    case '[' : parseArray(); break;
+    case '{' : parseInlineTable(); break;
+    default  : parseScalar(); break;
+    }
+  }
+
+  auto parseDocument() -> void {
+    while (true) {
+      skipWsCommentsAndNewlines();
+      if (atEnd()) {
+        return;
+      }
+      sink.statement();
+      if (peek() == '[') {
+        parseHeader();
+      } else {
+        parseKeyValue();
+        expectLineEnd();
+      }
+    }
+  }
+};
+
+inline auto checkInput(std::string_view source, std::string_view context) -> scan_detail::SourceCheck {
+  auto const check = scan_detail::checkSource(source);
+  if (check.loneCarriageReturn || check.malformedUtf8) {
+    auto message = std::string{context};
+    message.append(check.loneCarriageReturn ? ": E_INL" : ": E_UTF8");
+    fail(std::move(message));
+  }
+  return check;
+}
+
+inline auto parseInto(Document& doc, std::string_view source, std::string_view context) -> void {
+  auto const check   = checkInput(source, context);
+  auto       builder = TreeBuilder{source, doc.arena.get()};
+  builder.begin();
+  auto grammar        = Grammar<TreeBuilder>{source, builder, doc.arena.get()};
+  grammar.context     = context;
+  grammar.hasControls = check.controlCharacters;
+  grammar.parseDocument();
+  doc.source   = source;
+  doc.rootNode = builder.root;
+}
+
+inline auto makeArena(std::size_t sourceBytes, std::size_t extraBytes = 0)
+  -> std::unique_ptr<std::pmr::monotonic_buffer_resource> {
+  auto const estimate = std::max(sourceBytes * arenaBytesPerSourceByte, minimumArenaBytes);
+  auto const initial  = std::min(estimate, maximumInitialArenaBytes) + extraBytes;
+  return std::make_unique<std::pmr::monotonic_buffer_resource>(initial);
+}
+
+#if TOML26_HAS_MMAP
+// Closes the descriptor on every exit from mapFile, including a throwing allocation.
+struct FileDescriptor {
+  int fd = -1;
+
+  explicit FileDescriptor(int descriptor): fd{descriptor} {}
+  FileDescriptor(FileDescriptor const&)                    = delete;
+  auto operator=(FileDescriptor const&) -> FileDescriptor& = delete;
+
+  ~FileDescriptor() {
+    if (fd >= 0) {
+      ::close(fd);
+    }
+  }
+};
+
+inline auto mapFile(std::filesystem::path const& path, std::string_view context) -> std::unique_ptr<MappedFile> {
+  auto const file = FileDescriptor{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+  if (file.fd < 0) {
+    fail(std::string{context} + ": cannot open " + path.string());
+  }
+  struct stat info{};
+  if (::fstat(file.fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+    fail(std::string{context} + ": not a regular file " + path.string());
+  }
+  auto mapping = std::make_unique<MappedFile>();
+  if (info.st_size > 0) {
+    auto const length  = static_cast<std::size_t>(info.st_size);
+    auto*      address = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, file.fd, 0);
+    if (address == MAP_FAILED) {
+      fail(std::string{context} + ": cannot map " + path.string());
+    }
+    mapping->address = address;
+    mapping->length  = length;
+  }
+  return mapping;
+}
+#else
+inline auto readFile(std::filesystem::path const& path, std::pmr::memory_resource& arena, std::size_t length)
+  -> std::string_view {
+  auto file = std::ifstream{path, std::ios::binary};
+  if (!file) {
+    fail("load_file: cannot open " + path.string());
+  }
+  auto* data = static_cast<char*>(arena.allocate(length + 1, alignof(char)));
+  file.read(data, static_cast<std::streamsize>(length));
+  return {data, static_cast<std::size_t>(file.gcount())};
+}
+#endif
+}  // namespace runtime_detail
+
+inline auto parse_runtime(std::string_view source) -> Document {
+  auto const normalized = detail::normalizeSourceView(source);
+  auto       doc        = Document{runtime_detail::makeArena(normalized.size(), normalized.size() + 1)};
+  auto*      copy       = static_cast<char*>(doc.arena->allocate(normalized.size() + 1, alignof(char)));
+  std::ranges::copy(normalized, copy);
+  copy[normalized.size()] = '\0';
+  runtime_detail::parseInto(doc, std::string_view{copy, normalized.size()}, "parse_runtime");
+  return doc;
+}
+
+inline auto parse_borrowed(std::string_view source) -> Document {
+  auto const normalized = detail::normalizeSourceView(source);
+  auto       doc        = Document{runtime_detail::makeArena(normalized.size())};
+  runtime_detail::parseInto(doc, normalized, "parse_borrowed");
+  return doc;
+}
+
+inline auto load_file(std::filesystem::path const& path) -> Document {
+#if TOML26_HAS_MMAP
+  auto mapping = runtime_detail::mapFile(path, "load_file");
+  auto doc     = Document{runtime_detail::makeArena(mapping->length)};
+  if (mapping->address != nullptr) {
+    ::madvise(mapping->address, mapping->length, MADV_SEQUENTIAL);
+  }
+  runtime_detail::parseInto(doc, mapping->bytes(), "load_file");
+  if (mapping->address != nullptr) {
+    ::madvise(mapping->address, mapping->length, MADV_NORMAL);
+  }
+  doc.mapping = std::move(mapping);
+#else
+  auto const length = static_cast<std::size_t>(std::filesystem::file_size(path));
+  auto       doc    = Document{runtime_detail::makeArena(length, length + 1)};
+  runtime_detail::parseInto(doc, runtime_detail::readFile(path, *doc.arena, length), "load_file");
+#endif
+  return doc;
+}
+
+// A `toml::path` spec parsed once for runtime documents. bind() records where each key sits in its table; later
+// evaluations step through those positions and confirm each with one key comparison, so a lookup costs O(depth) with
+// no hashing. A position that does not hold the bound key (another document, a reparse into the same buffer, or a
+// path that was never bound) falls back to the hashed lookup for that step.
+struct CompiledPath {
+  struct Step {
+    std::string key{};
+    std::size_t index   = 0;
+    bool        isIndex = false;
+  };
+
+  std::vector<Step> steps{};
+
+  explicit CompiledPath(std::string_view spec) {
+    for (auto& step: path_detail::parsePathSpec(spec)) {
+      steps.push_back(Step{std::move(step.key), step.index, step.isIndex});
+    }
+  }
+
+  auto bind(Document const& doc) -> bool {
+    auto const* node = doc.rootNode;
+    for (auto& step: steps) {
+      if (node == nullptr) {
+        return false;
+      }
+      if (step.isIndex) {
+        node = nextByIndex(*node, step.index);
+        continue;
+      }
+      auto const* entries = tableEntries(*node);
+      node                = nullptr;
+      if (entries != nullptr) {
+        for (std::size_t i = 0; i < entries->size(); ++i) {
+          if ((*entries)[i].key == step.key) {
+            step.index = i;
+            node       = (*entries)[i].value;
+            break;
+          }
+        }
+      }
+    }
+    return node != nullptr;
+  }
+
+  auto operator()(Document const& doc) const -> ValueRef {
+    auto const* node = doc.rootNode;
+    for (auto const& step: steps) {
+      if (node == nullptr) {
+        return ValueRef{};
+      }
+      node = step.isIndex ? nextByIndex(*node, step.index) : nextByKey(*node, step);
+    }
+    return node == nullptr ? ValueRef{} : runtime_detail::valueRefOf(*node);
+  }
+
+ private:
+  static auto tableEntries(runtime_detail::Node const& node) -> std::pmr::vector<runtime_detail::Entry> const* {
+    return node.type == ValueType::table ? &node.scalar.children->entries : nullptr;
+  }
+
+  static auto nextByIndex(runtime_detail::Node const& node, std::size_t index) -> runtime_detail::Node const* {
+    if (node.type != ValueType::array) {
+      return nullptr;
+    }
+    auto const& elements = node.scalar.children->entries;
+    return index < elements.size() ? elements[index].value : nullptr;
+  }
+
+  static auto nextByKey(runtime_detail::Node const& node, Step const& step) -> runtime_detail::Node const* {
+    auto const* entries = tableEntries(node);
+    if (entries == nullptr) {
+      return nullptr;
+    }
+    // Compare the bytes, not just the address: a document reparsed into the same buffer can hold another key of the
+    // same length where the bound one used to be.
+    if (step.index < entries->size() && (*entries)[step.index].key == step.key) {
+      return (*entries)[step.index].value;
+    }
+    return runtime_detail::findEntry(node, step.key);
+  }
+};
+}  // namespace toml
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef TOML26_FOR_EACH_HPP
+#define TOML26_FOR_EACH_HPP
+
+namespace for_each_detail {
+template<typename T>
+concept Container = requires { typename T::TomlArrayTag; } || requires { T::keyNames; };
+
+template<typename T>
+concept ArrayContainer = Container<T> && requires { typename T::TomlArrayTag; };
+
+// Path of child `I` of `Node` below `prefix`, interned so it can be a template argument of the next level.
+template<typename Node, std::size_t I>
+consteval auto childPath(std::string_view prefix) -> char const* {
+  auto out = std::string{prefix};
+  if constexpr (ArrayContainer<Node>) {
+    path_detail::appendPathIndex(out, I);
+  } else {
+    path_detail::appendPathKey(out, Node::template key<I>());
+  }
+  return std::define_static_string(out);
+}
+
+inline constexpr char const* rootPath = std::define_static_string(std::string_view{});
+
+template<char const* Prefix, typename Node, typename Visitor>
+constexpr auto forEachLeaf(Node const& node, Visitor& visitor) -> void {
+  template for (constexpr auto i: Node::indices()) {
+    constexpr char const* path  = childPath<Node, i>(Prefix);
+    auto const&           child = node.template get<i>();
+    if constexpr (Container<std::remove_cvref_t<decltype(child)>>) {
+      forEachLeaf<path>(child, visitor);
+    } else {
+      visitor(std::string_view{path}, child);
+    }
+  }
+}
+}  // namespace for_each_detail
+
+// Calls `visitor(key, member)` for every direct child of a compile-time table or array, in document order. Tables
+// pass the key as `std::string_view`, arrays the element index as `std::size_t`; `member` is a reference of the
+// member's real type (`std::int64_t const&`, `char const* const&`, a nested `TableObject`, ...). The loop is a
+// `template for`, so each call is a direct, inlinable call with no `ValueRef` in between.
+template<typename Node, typename Visitor>
+requires for_each_detail::Container<Node>
+constexpr auto for_each(Node const& node, Visitor&& visitor) -> void {
+  template for (constexpr auto i: Node::indices()) {
+    if constexpr (for_each_detail::ArrayContainer<Node>) {
+      visitor(std::size_t{i}, node.template get<i>());
+    } else {
+      visitor(Node::template key<i>(), node.template get<i>());
+    }
+  }
+}
+
+// Calls `visitor(path, leaf)` for every scalar below `node`, descending into tables and arrays. `path` is the leaf's
+// canonical `toml::path` spelling relative to `node` (e.g. `servers.alpha.ports[1]`), fixed at compile time.
+template<typename Node, typename Visitor>
+requires for_each_detail::Container<Node>
+constexpr auto for_each_leaf(Node const& node, Visitor&& visitor) -> void {
+  for_each_detail::forEachLeaf<for_each_detail::rootPath>(node, visitor);
+}
+
+#endif
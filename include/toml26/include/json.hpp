@@ -1,6 +1,8 @@
 #ifndef TOML26_JSON_HPP
 #define TOML26_JSON_HPP
 
+#include <iterator>
+#include <meta>
 #include <string>
 #include <string_view>
 
@@ -8,30 +10,53 @@
 
 namespace toml {
 template<typename Root>
+constexpr auto json_size(Root const& root, JsonFormat format = {}) -> std::size_t {
+  auto counter = json_detail::SizeCounter{};
+  json_detail::appendJsonValue(counter, ValueRef::from(root), format, 0);
+  return counter.size;
+}
+
+template<typename Root, json_detail::JsonSink Out>
+constexpr auto to_json(Root const& root, Out& out, JsonFormat format = {}) -> void {
+  json_detail::appendJsonValue(out, ValueRef::from(root), format, 0);
+  if constexpr (requires { out.flush(); }) {
+    out.flush();
+  }
+}
+
+template<typename Root, std::output_iterator<char> It>
+requires(!json_detail::JsonSink<It>)
+constexpr auto to_json(Root const& root, It it, JsonFormat format = {}) -> It {
+  auto sink = json_detail::IteratorSink<It>{it};
+  json_detail::appendJsonValue(sink, ValueRef::from(root), format, 0);
+  return sink.it;
+}
+
+// Single pass, letting the string grow geometrically. Callers who want exactly one allocation reserve `json_size`
+// themselves and use the sink overload.
+template<typename Root>
 constexpr auto to_json(Root const& root, JsonFormat format = {}) -> std::string {
   auto out = std::string{};
   json_detail::appendJsonValue(out, ValueRef::from(root), format, 0);
   return out;
 }
 
+// Emits and interns the JSON text of a constant root, so the binary keeps exactly the emitted bytes.
+template<typename Root>
+consteval auto to_json_static(Root const& root, JsonFormat format = {}) -> std::string_view {
+  auto const json = to_json(root, format);
+  return std::string_view{std::define_static_string(json), json.size()};
+}
+
 template<FixedString Source>
-consteval auto to_json(JsonFormat format = {}) {
-  auto const     json     = to_json(parse<Source>(), format);
-  constexpr auto capacity = Source.view().size() * 8 + 256;
-  auto           out      = JsonBuffer<capacity>{};
-  out.append(std::string_view{json});
-  return out;
+consteval auto to_json(JsonFormat format = {}) -> std::string_view {
+  return to_json_static(parse<Source>(), format);
 }
 
 template<auto SourceBytes>
-consteval auto to_json(JsonFormat format = {}) {
-  auto const     json     = to_json(parse<SourceBytes>(), format);
-  constexpr auto capacity = SourceBytes.size() * 8 + 256;
-  auto           out      = JsonBuffer<capacity>{};
-  out.append(std::string_view{json});
-  return out;
+consteval auto to_json(JsonFormat format = {}) -> std::string_view {
+  return to_json_static(parse<SourceBytes>(), format);
 }
 }  // namespace toml
 
 #endif
-
@@ -1,11 +1,20 @@
 #ifndef TOML26_JSON_TYPES_HPP
 #define TOML26_JSON_TYPES_HPP
 
+#include <algorithm>
 #include <array>
+#include <cerrno>
 #include <string>
 #include <string_view>
 #include <utility>
 
+#if __has_include(<unistd.h>)
+#include <unistd.h>
+#define TOML26_HAS_FD_WRITER 1
+#else
+#define TOML26_HAS_FD_WRITER 0
+#endif
+
 namespace toml {
 [[noreturn]] constexpr auto failJson(std::string message) -> void { throw std::move(message); }
 
@@ -35,6 +44,50 @@ struct JsonBuffer {
   constexpr auto view() const -> std::string_view { return std::string_view{bytes.data(), size}; }
   constexpr      operator std::string_view() const { return view(); }
 };
+
+#if TOML26_HAS_FD_WRITER
+// Buffers output in place and hands it to write(2) in blocks; to_json flushes it when emission finishes.
+struct JsonFdWriter {
+  int                    fd = -1;
+  std::array<char, 8192> bytes{};
+  std::size_t            size = 0;
+
+  auto push_back(char c) -> void {
+    if (size == bytes.size()) {
+      flush();
+    }
+    bytes[size++] = c;
+  }
+
+  auto append(std::string_view sv) -> void {
+    while (!sv.empty()) {
+      if (size == bytes.size()) {
+        flush();
+      }
+      auto const chunk = std::min(sv.size(), bytes.size() - size);
+      std::ranges::copy(sv.substr(0, chunk), bytes.begin() + static_cast<std::ptrdiff_t>(size));
+      size += chunk;
+      sv.remove_prefix(chunk);
+    }
+  }
+
+  auto flush() -> void {
+    std::size_t done = 0;
+    while (done < size) {
+      auto const written = ::write(fd, bytes.data() + done, size - done);
+      if (written < 0 && errno == EINTR) {
+        continue;
+      }
+      if (written <= 0) {
+        size = 0;
+        failJson(std::string{"json fd write failed"});
+      }
+      done += static_cast<std::size_t>(written);
+    }
+    size = 0;
+  }
+};
+#endif
 }  // namespace toml
 
 #endif
@@ -0,0 +1,134 @@
+#ifndef TOML26_KEY_INDEX_HPP
+#define TOML26_KEY_INDEX_HPP
+
+namespace hash_detail {
+constexpr auto hashKey(std::string_view key) -> std::uint64_t {
+  auto h = std::uint64_t{0xCBF29CE484222325ULL};
+  for (char const c: key) {
+    h ^= static_cast<unsigned char>(c);
+    h *= 0x100000001B3ULL;
+  }
+  return h;
+}
+
+constexpr auto mixSeed(std::uint64_t hash, std::uint64_t seed) -> std::uint64_t {
+  auto x = hash ^ (seed * 0x9E3779B97F4A7C15ULL);
+  x ^= x >> 33U;
+  x *= 0xFF51AFD7ED558CCDULL;
+  x ^= x >> 33U;
+  x *= 0xC4CEB9FE1A85EC53ULL;
+  x ^= x >> 33U;
+  return x;
+}
+
+template<std::size_t N>
+struct KeyIndex {
+  static constexpr std::size_t slotCount   = std::bit_ceil(N + N / 4 + 1);
+  static constexpr std::size_t bucketCount = std::bit_ceil(N / 4 + 1);
+
+  std::array<std::int64_t, bucketCount> displacements{};
+  std::array<std::uint32_t, slotCount>  slotKeys{};
+
+  constexpr auto slotOf(std::uint64_t hash) const -> std::size_t {
+    auto const d = displacements[hash & (bucketCount - 1)];
+    if (d < 0) {
+      return static_cast<std::size_t>(-(d + 1));
+    }
+    return static_cast<std::size_t>(mixSeed(hash, static_cast<std::uint64_t>(d)) & (slotCount - 1));
+  }
+
+  constexpr auto find(std::array<std::string_view, N> const& keys, std::string_view key) const -> std::size_t {
+    auto const idx = slotKeys[slotOf(hashKey(key))];
+    if (idx < N && keys[idx] == key) {
+      return idx;
+    }
+    return N;
+  }
+};
+
+// Multi-key buckets are placed first, while most slots are free, so distinct hashes separate within a few seeds.
+// The cap turns a pathological input into a named error instead of a hit on the constexpr step limit.
+inline constexpr std::uint64_t maxSeedAttempts = 4096;
+
+template<std::size_t N>
+consteval auto buildKeyIndex(std::array<std::string_view, N> const& keys) -> KeyIndex<N> {
+  using Index = KeyIndex<N>;
+  auto out    = Index{};
+  out.slotKeys.fill(static_cast<std::uint32_t>(N));
+
+  std::vector<std::uint64_t>            hashes(N);
+  std::vector<std::vector<std::size_t>> buckets(Index::bucketCount);
+  for (std::size_t i = 0; i < N; ++i) {
+    hashes[i] = hashKey(keys[i]);
+    buckets[hashes[i] & (Index::bucketCount - 1)].emplace_back(i);
+  }
+
+  std::vector<std::size_t> order(Index::bucketCount);
+  for (std::size_t b = 0; b < order.size(); ++b) {
+    order[b] = b;
+  }
+  std::ranges::sort(order, [&](std::size_t lhs, std::size_t rhs) {
+    if (buckets[lhs].size() != buckets[rhs].size()) {
+      return buckets[lhs].size() > buckets[rhs].size();
+    }
+    return lhs < rhs;
+  });
+
+  std::vector<bool>        used(Index::slotCount, false);
+  std::vector<std::size_t> slots{};
+  std::size_t              nextFree = 0;
+  for (auto const b: order) {
+    auto const& members = buckets[b];
+    if (members.empty()) {
+      break;
+    }
+    if (members.size() == 1) {
+      while (used[nextFree]) {
+        ++nextFree;
+      }
+      used[nextFree]         = true;
+      out.slotKeys[nextFree] = static_cast<std::uint32_t>(members[0]);
+      out.displacements[b]   = -static_cast<std::int64_t>(nextFree) - 1;
+      continue;
+    }
+    // The seed only re-mixes the stored hash, so two keys with equal hashes collide under every seed.
+    for (std::size_t i = 0; i < members.size(); ++i) {
+      for (std::size_t j = i + 1; j < members.size(); ++j) {
+        auto const& lhs = keys[members[i]];
+        auto const& rhs = keys[members[j]];
+        if (lhs == rhs) {
+          fail("buildKeyIndex: duplicate key \"" + std::string{lhs} + "\"");
+        }
+        if (hashes[members[i]] == hashes[members[j]]) {
+          fail("buildKeyIndex: keys \"" + std::string{lhs} + "\" and \"" + std::string{rhs} + "\" share a hash");
+        }
+      }
+    }
+    bool placed = false;
+    for (std::uint64_t seed = 1; !placed && seed <= maxSeedAttempts; ++seed) {
+      slots.clear();
+      for (auto const i: members) {
+        auto const slot = static_cast<std::size_t>(mixSeed(hashes[i], seed) & (Index::slotCount - 1));
+        if (used[slot] || std::ranges::find(slots, slot) != slots.end()) {
+          break;
+        }
+        slots.emplace_back(slot);
+      }
+      if (slots.size() == members.size()) {
+        for (std::size_t j = 0; j < members.size(); ++j) {
+          used[slots[j]]         = true;
+          out.slotKeys[slots[j]] = static_cast<std::uint32_t>(members[j]);
+        }
+        out.displacements[b] = static_cast<std::int64_t>(seed);
+        placed               = true;
+      }
+    }
+    if (!placed) {
+      fail("buildKeyIndex: no seed separates the bucket of \"" + std::string{keys[members[0]]} + "\"");
+    }
+  }
+  return out;
+}
+}  // namespace hash_detail
+
+#endif
@@ -0,0 +1,488 @@
+#ifndef TOML26_LOAD_HPP
+#define TOML26_LOAD_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <meta>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "document.hpp"
+
+namespace toml {
+namespace load_detail {
+struct Slot;
+
+// Writable counterpart of `ValueOps` for one generated type: tables resolve a key through the type's perfect hash,
+// arrays hand out their fixed number of elements.
+struct SlotOps {
+  Slot (*child)(void* object, std::string_view key) = nullptr;
+  Slot (*element)(void* object, std::size_t idx)    = nullptr;
+  std::size_t size                                  = 0;
+};
+
+inline constexpr auto scalarSlotOps = SlotOps{};
+
+// A member of the object being loaded. `leaf` numbers the first scalar below it in document pre-order, so every
+// scalar of the shape has one bit in the loader's seen set.
+struct Slot {
+  ValueType      type = ValueType::none;
+  void*          ptr  = nullptr;
+  SlotOps const* ops  = &scalarSlotOps;
+  std::size_t    leaf = 0;
+};
+
+template<typename T>
+consteval auto scalarTypeOf() -> ValueType {
+  if constexpr (std::same_as<T, char const*>) {
+    return ValueType::string;
+  } else if constexpr (std::same_as<T, std::int64_t>) {
+    return ValueType::integer;
+  } else if constexpr (std::same_as<T, double>) {
+    return ValueType::floating;
+  } else if constexpr (std::same_as<T, bool>) {
+    return ValueType::boolean;
+  } else if constexpr (std::same_as<T, OffsetDateTime>) {
+    return ValueType::offsetDateTime;
+  } else if constexpr (std::same_as<T, LocalDateTime>) {
+    return ValueType::localDateTime;
+  } else if constexpr (std::same_as<T, LocalDate>) {
+    return ValueType::localDate;
+  } else if constexpr (std::same_as<T, LocalTime>) {
+    return ValueType::localTime;
+  } else {
+    return ValueType::none;
+  }
+}
+
+template<typename T>
+concept ScalarArray = requires {
+  typename T::TomlArrayTag;
+  typename T::ElementType;
+};
+
+template<typename T>
+concept MemberArray = !ScalarArray<T> && requires { typename T::TomlArrayTag; };
+
+template<typename T>
+struct StorageOf {
+  using type = T::UnderlyingRep;
+};
+
+template<MemberArray T>
+struct StorageOf<T> {
+  using type = T::StorageRep;
+};
+
+template<typename T>
+consteval auto leafCount() -> std::size_t {
+  if constexpr (scalarTypeOf<T>() != ValueType::none) {
+    return 1;
+  } else if constexpr (ScalarArray<T>) {
+    return T::staticSize();
+  } else {
+    using Storage      = StorageOf<T>::type;
+    auto           sum = std::size_t{0};
+    constexpr auto ctx = meta::access_context::current();
+    template for (constexpr auto m: define_static_array(nonstatic_data_members_of(^^Storage, ctx))) {
+      using Member = [:type_of(m):];
+      sum += leafCount<Member>();
+    }
+    return sum;
+  }
+}
+
+template<typename T>
+consteval auto leafOffset(std::size_t position) -> std::size_t {
+  using Storage      = StorageOf<T>::type;
+  auto           sum = std::size_t{0};
+  auto           i   = std::size_t{0};
+  constexpr auto ctx = meta::access_context::current();
+  template for (constexpr auto m: define_static_array(nonstatic_data_members_of(^^Storage, ctx))) {
+    using Member = [:type_of(m):];
+    if (i++ < position) {
+      sum += leafCount<Member>();
+    }
+  }
+  return sum;
+}
+
+// Canonical `toml::path` of every scalar of `T`, in the order `leaf` numbers them.
+template<typename T>
+consteval auto collectLeafPaths(std::vector<std::string>& out, std::string const& prefix) -> void {
+  if constexpr (scalarTypeOf<T>() != ValueType::none) {
+    out.push_back(prefix);
+  } else if constexpr (ScalarArray<T>) {
+    for (std::size_t i = 0; i < T::staticSize(); ++i) {
+      auto path = prefix;
+      path_detail::appendPathIndex(path, i);
+      out.push_back(path);
+    }
+  } else {
+    using Storage      = StorageOf<T>::type;
+    auto           i   = std::size_t{0};
+    constexpr auto ctx = meta::access_context::current();
+    template for (constexpr auto m: define_static_array(nonstatic_data_members_of(^^Storage, ctx))) {
+      using Member = [:type_of(m):];
+      auto path    = prefix;
+      if constexpr (MemberArray<T>) {
+        path_detail::appendPathIndex(path, i);
+      } else {
+        path_detail::appendPathKey(path, T::keyNames[i]);
+      }
+      collectLeafPaths<Member>(out, path);
+      ++i;
+    }
+  }
+}
+
+template<typename T>
+consteval auto internLeafPaths() -> std::span<char const* const> {
+  auto paths = std::vector<std::string>{};
+  collectLeafPaths<T>(paths, std::string{});
+  auto out = std::vector<char const*>{};
+  for (auto const& path: paths) {
+    out.push_back(std::define_static_string(path));
+  }
+  return std::define_static_array(out);
+}
+
+template<typename T>
+inline constexpr auto leafPaths = internLeafPaths<T>();
+
+template<typename T>
+auto slotOf(T& value, std::size_t leaf) -> Slot;
+
+template<typename T>
+using Setter = Slot (*)(T&);
+
+// One setter per member, in member order: a table looks its key up through `indexOf` and lands here directly.
+template<typename T>
+consteval auto makeSetters() {
+  using Storage          = StorageOf<T>::type;
+  constexpr auto ctx     = meta::access_context::current();
+  constexpr auto members = define_static_array(nonstatic_data_members_of(^^Storage, ctx));
+  auto           out     = std::array<Setter<T>, members.size()>{};
+  template for (constexpr auto i: define_static_array(std::views::iota(0zu, members.size()))) {
+    constexpr auto m      = members[i];
+    constexpr auto offset = leafOffset<T>(i);
+    out[i]                = [](T& self) -> Slot { return slotOf(static_cast<Storage&>(self).[:m:], offset); };
+  }
+  return out;
+}
+
+template<typename T>
+auto setters() -> auto const& {
+  static constexpr auto table = makeSetters<T>();
+  return table;
+}
+
+template<typename Table>
+auto tableChild(void* object, std::string_view key) -> Slot {
+  auto const idx = Table::indexOf(key);
+  if (idx >= Table::keyNames.size()) {
+    return Slot{};
+  }
+  return setters<Table>()[idx](*static_cast<Table*>(object));
+}
+
+template<typename Array>
+auto arrayElement(void* object, std::size_t idx) -> Slot {
+  auto& array = *static_cast<Array*>(object);
+  if constexpr (ScalarArray<Array>) {
+    return slotOf(array.elements[idx], idx);
+  } else {
+    return setters<Array>()[idx](array);
+  }
+}
+
+template<typename Table>
+auto tableSlotOps() -> SlotOps const& {
+  static constexpr auto instance = SlotOps{&tableChild<Table>, nullptr, 0};
+  return instance;
+}
+
+template<typename Array>
+auto arraySlotOps() -> SlotOps const& {
+  static constexpr auto instance = SlotOps{nullptr, &arrayElement<Array>, Array::staticSize()};
+  return instance;
+}
+
+template<typename T>
+auto slotOf(T& value, std::size_t leaf) -> Slot {
+  if constexpr (constexpr auto type = scalarTypeOf<T>(); type != ValueType::none) {
+    return Slot{type, &value, &scalarSlotOps, leaf};
+  } else if constexpr (requires { typename T::TomlArrayTag; }) {
+    return Slot{ValueType::array, &value, &arraySlotOps<T>(), leaf};
+  } else {
+    static_assert(requires { typename T::TomlTableTag; }, "load_into: unsupported member type");
+    return Slot{ValueType::table, &value, &tableSlotOps<T>(), leaf};
+  }
+}
+
+template<typename Root>
+struct RootTable;
+
+template<typename Rep>
+struct RootTable<RootObject<Rep>> {
+  using type = Rep;
+};
+
+inline auto childOf(Slot const& table, std::string_view key) -> Slot {
+  auto child = table.ops->child(table.ptr, key);
+  child.leaf += table.leaf;
+  return child;
+}
+
+inline auto elementOf(Slot const& array, std::size_t idx) -> Slot {
+  auto element = array.ops->element(array.ptr, idx);
+  element.leaf += array.leaf;
+  return element;
+}
+
+inline auto describe(std::span<std::string_view const> path) -> std::string {
+  auto out = std::string{};
+  for (auto const key: path) {
+    path_detail::appendPathKey(out, key);
+  }
+  return out;
+}
+
+inline constexpr std::size_t keyBufferBytes = 256;
+
+// Grammar sink that writes every value straight into its member. Keys resolve through each table's perfect hash;
+// a key the shape lacks, a value of another type, an array of another length, a second write to the same scalar
+// and a scalar never written are errors. Strings are copied, NUL-terminated, into `strings`.
+struct Loader {
+  struct Frame {
+    Slot             node{};
+    Slot             target{};
+    std::size_t      next = 0;
+    std::string_view leaf{};
+  };
+
+  struct TableArray {
+    void const* array = nullptr;
+    std::size_t count = 0;
+  };
+
+  Slot                                  root{};
+  std::pmr::memory_resource*            strings = nullptr;
+  std::span<char const* const>          paths{};
+  std::vector<bool>                     seen = std::vector<bool>(paths.size());
+  Slot                                  current = root;
+  Slot                                  target{};
+  std::string_view                      leaf{};
+  std::vector<Frame>                    frames{};
+  std::vector<TableArray>               tableArrays{};
+  std::array<std::byte, keyBufferBytes> buffer{};
+  std::pmr::monotonic_buffer_resource   keys{buffer.data(), buffer.size()};
+
+  auto keep(std::string_view text) -> std::string_view {
+    auto* chars = static_cast<char*>(keys.allocate(text.size() + 1, alignof(char)));
+    std::ranges::copy(text, chars);
+    chars[text.size()] = '\0';
+    return std::string_view{chars, text.size()};
+  }
+
+  auto statement() -> void { keys.release(); }
+
+  auto appended(Slot const& array) const -> std::size_t {
+    auto const entry = std::ranges::find(tableArrays, array.ptr, &TableArray::array);
+    return entry == tableArrays.end() ? 0 : entry->count;
+  }
+
+  [[noreturn]] static auto unexpected(std::span<std::string_view const> path, Slot const& found, std::string_view kind)
+    -> void {
+    fail("load_into: " + describe(path) + std::string{found.type == ValueType::none ? " is not in the shape" : kind});
+  }
+
+  auto descend(Slot const& table, std::string_view key, std::span<std::string_view const> path) -> Slot {
+    auto child = childOf(table, key);
+    if (child.type == ValueType::array && appended(child) > 0) {
+      child = elementOf(child, appended(child) - 1);
+    }
+    if (child.type != ValueType::table) {
+      unexpected(path, child, " is not a table");
+    }
+    return child;
+  }
+
+  auto parentOf(std::span<std::string_view const> path, Slot from) -> Slot {
+    for (std::size_t i = 0; i + 1 < path.size(); ++i) {
+      from = descend(from, path[i], path.first(i + 1));
+    }
+    return from;
+  }
+
+  auto table(std::span<std::string_view const> path) -> detail::ParseError {
+    current = descend(parentOf(path, root), path.back(), path);
+    return detail::ParseError::none;
+  }
+
+  auto arrayTable(std::span<std::string_view const> path) -> detail::ParseError {
+    auto const array = childOf(parentOf(path, root), path.back());
+    if (array.type != ValueType::array) {
+      unexpected(path, array, " is not an array");
+    }
+    auto entry = std::ranges::find(tableArrays, array.ptr, &TableArray::array);
+    if (entry == tableArrays.end()) {
+      entry = tableArrays.insert(tableArrays.end(), TableArray{array.ptr, 0});
+    }
+    if (entry->count >= array.ops->size) {
+      fail("load_into: " + describe(path) + " has more elements than the shape");
+    }
+    current = elementOf(array, entry->count++);
+    if (current.type != ValueType::table) {
+      unexpected(path, current, " elements are not tables");
+    }
+    return detail::ParseError::none;
+  }
+
+  auto key(std::span<std::string_view const> path) -> detail::ParseError {
+    auto const parent = parentOf(path, frames.empty() ? current : frames.back().node);
+    auto const child  = childOf(parent, path.back());
+    if (child.type == ValueType::none) {
+      unexpected(path, child, {});
+    }
+    if (frames.empty()) {
+      target = child;
+      leaf   = path.back();
+    } else {
+      frames.back().target = child;
+      frames.back().leaf   = path.back();
+    }
+    return detail::ParseError::none;
+  }
+
+  auto place() -> Slot {
+    if (frames.empty()) {
+      return target;
+    }
+    auto& top = frames.back();
+    if (top.node.type != ValueType::array) {
+      return top.target;
+    }
+    if (top.next >= top.node.ops->size) {
+      fail("load_into: " + std::string{top.leaf} + " has more elements than the shape");
+    }
+    return elementOf(top.node, top.next++);
+  }
+
+  // Scalars are named by their full path; tables and arrays by the key that introduced them.
+  [[noreturn]] auto mismatch(Slot const& slot) const -> void {
+    auto const scalar = slot.ops == &scalarSlotOps && slot.type != ValueType::none;
+    auto const name   = scalar ? std::string_view{paths[slot.leaf]} : frames.empty() ? leaf : frames.back().leaf;
+    fail("load_into: " + std::string{name} + " has a different type in the shape");
+  }
+
+  auto scalar(runtime_detail::Node const& value) -> void {
+    auto const slot = place();
+    if (slot.type != value.type) {
+      mismatch(slot);
+    }
+    if (seen[slot.leaf]) {
+      fail("load_into: " + std::string{paths[slot.leaf]} + " is defined twice");
+    }
+    seen[slot.leaf] = true;
+    auto const& s   = value.scalar;
+    switch (value.type) {
+    case ValueType::string: {
+      auto* chars = static_cast<char*>(strings->allocate(s.string.size + 1, alignof(char)));
+      std::ranges::copy(std::string_view{s.string.data, s.string.size}, chars);
+      chars[s.string.size]                 = '\0';
+      *static_cast<char const**>(slot.ptr) = chars;
+      break;
+    }
+    case ValueType::integer       : *static_cast<std::int64_t*>(slot.ptr) = s.integer; break;
+    case ValueType::floating      : *static_cast<double*>(slot.ptr) = s.floating; break;
+    case ValueType::boolean       : *static_cast<bool*>(slot.ptr) = s.boolean; break;
+    case ValueType::offsetDateTime: *static_cast<OffsetDateTime*>(slot.ptr) = s.offsetDateTime; break;
+    case ValueType::localDateTime : *static_cast<LocalDateTime*>(slot.ptr) = s.localDateTime; break;
+    case ValueType::localDate     : *static_cast<LocalDate*>(slot.ptr) = s.localDate; break;
+    case ValueType::localTime     : *static_cast<LocalTime*>(slot.ptr) = s.localTime; break;
+    default                       : mismatch(slot);
+    }
+  }
+
+  auto beginArray() -> void {
+    auto const slot = place();
+    if (slot.type != ValueType::array) {
+      mismatch(slot);
+    }
+    frames.push_back(Frame{slot, {}, 0, frames.empty() ? leaf : frames.back().leaf});
+  }
+
+  auto endArray() -> void {
+    auto const& top = frames.back();
+    if (top.next != top.node.ops->size) {
+      fail("load_into: " + std::string{top.leaf} + " has fewer elements than the shape");
+    }
+    frames.pop_back();
+  }
+
+  auto beginInlineTable() -> void {
+    auto const slot = place();
+    if (slot.type != ValueType::table) {
+      mismatch(slot);
+    }
+    frames.push_back(Frame{slot});
+  }
+
+  auto endInlineTable() -> void { frames.pop_back(); }
+
+  auto comment(std::string_view) -> void {}
+
+  auto finish() const -> void {
+    auto const missing = std::ranges::find(seen, false);
+    if (missing != seen.end()) {
+      fail("load_into: missing key " + std::string{paths[static_cast<std::size_t>(missing - seen.begin())]});
+    }
+  }
+};
+}  // namespace load_detail
+
+// A runtime-loaded value of a generated shape. `value` has exactly the type of the compile-time root it was shaped
+// after, so typed access (`loaded->physical.color`) compiles to the same member loads; `strings` owns the text of its
+// string members.
+template<typename Root>
+struct Loaded {
+  std::unique_ptr<std::pmr::monotonic_buffer_resource> strings{};
+  Root                                                 value{};
+
+  auto operator*() const -> Root const& { return value; }
+  auto operator->() const -> Root const* { return &value; }
+};
+
+// Parses runtime `source` into the shape of a `parse<...>()` root, e.g. `load_into<decltype(cfg)>(text)`. No document
+// tree is built: every key goes through its table's compile-time perfect hash to a member setter. The text must
+// define exactly the shape's keys, with the same value types and array lengths.
+template<typename Root>
+auto load_into(std::string_view source) -> Loaded<std::remove_cv_t<Root>> {
+  using Table           = load_detail::RootTable<std::remove_cv_t<Root>>::type;
+  auto const normalized = detail::normalizeSourceView(source);
+  auto const check      = runtime_detail::checkInput(normalized, "load_into");
+  auto       out        = Loaded<std::remove_cv_t<Root>>{std::make_unique<std::pmr::monotonic_buffer_resource>()};
+  auto       loader     = load_detail::Loader{
+    load_detail::slotOf(static_cast<Table&>(out.value), 0),
+    out.strings.get(),
+    load_detail::leafPaths<Table>,
+  };
+  auto grammar        = runtime_detail::Grammar<load_detail::Loader>{normalized, loader};
+  grammar.context     = "load_into";
+  grammar.hasControls = check.controlCharacters;
+  grammar.parseDocument();
+  loader.finish();
+  return out;
+}
+}  // namespace toml
+
+#endif
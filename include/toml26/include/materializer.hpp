@@ -28,6 +28,7 @@ struct ArrayObject: Rep {
     }
   };
 
+  constexpr ArrayObject() = default;
   constexpr ArrayObject(Rep value): Rep(value) {}
 
   static consteval auto staticSize() -> std::size_t {
@@ -60,23 +61,33 @@ struct ArrayObject: Rep {
   }
 
   constexpr auto indexLookup(std::size_t idx) const -> ValueRef {
-    auto           out     = ValueRef{};
-    std::size_t    i       = 0;
-    constexpr auto ctx     = meta::access_context::current();
-    auto const&    storage = static_cast<StorageRep const&>(*this);
-    template for (constexpr auto m: define_static_array(nonstatic_data_members_of(^^StorageRep, ctx))) {
-      if (!out.valid() && i == idx) {
-        out = ValueRef::from(storage.[:m:]);
-      }
-      ++i;
+    if (idx >= staticSize()) {
+      return ValueRef{};
     }
-    return out;
+    return elementThunks()[idx](static_cast<StorageRep const&>(*this));
   }
 
   constexpr auto begin() const -> Iterator { return Iterator{this, 0}; }
   constexpr auto end() const -> Iterator { return Iterator{this, size()}; }
 
  private:
+  using ElementThunk = ValueRef (*)(StorageRep const&);
+
+  static consteval auto makeElementThunks() {
+    auto           out = std::array<ElementThunk, staticSize()>{};
+    std::size_t    i   = 0;
+    constexpr auto ctx = meta::access_context::current();
+    template for (constexpr auto m: define_static_array(nonstatic_data_members_of(^^StorageRep, ctx))) {
+      out[i++] = [](StorageRep const& storage) -> ValueRef { return ValueRef::from(storage.[:m:]); };
+    }
+    return out;
+  }
+
+  static constexpr auto elementThunks() -> auto const& {
+    static constexpr auto thunks = makeElementThunks();
+    return thunks;
+  }
+
   template<std::size_t I, std::size_t J>
   constexpr decltype(auto) getImpl() const {
     constexpr auto ctx     = meta::access_context::current();
@@ -96,6 +107,65 @@ struct ArrayObject: Rep {
   }
 };
 
+template<typename T, std::size_t N>
+struct ScalarArrayObject {
+  using TomlArrayTag = void;
+  using ElementType  = T;
+  struct Iterator {
+    ScalarArrayObject const* owner = nullptr;
+    std::size_t              index = 0;
+
+    constexpr auto operator*() const -> ValueRef { return ValueRef::from(owner->elements[index]); }
+    constexpr auto operator++() -> Iterator& {
+      ++index;
+      return *this;
+    }
+    constexpr friend auto operator==(Iterator const& lhs, Iterator const& rhs) -> bool {
+      return lhs.owner == rhs.owner && lhs.index == rhs.index;
+    }
+  };
+
+  std::array<T, N> elements;
+
+  static consteval auto staticSize() -> std::size_t { return N; }
+
+  static consteval auto indices() { return std::define_static_array(std::views::iota(0zu, N)); }
+
+  constexpr auto size() const -> std::size_t { return N; }
+
+  constexpr auto span() const -> std::span<T const, N> { return std::span<T const, N>{elements}; }
+
+  constexpr auto operator[](std::size_t idx) const -> ValueRef { return indexLookup(idx); }
+
+  template<std::size_t I>
+  constexpr auto get() const -> T const& {
+    static_assert(I < N, "array index out of range");
+    return elements[I];
+  }
+
+  template<typename First, typename... Rest>
+  requires(path_detail::CtPathSegmentType<First> && (... && path_detail::CtPathSegmentType<Rest>) )
+  constexpr decltype(auto) get() const {
+    return path_detail::ctPathGet<decltype(*this), First, Rest...>(*this);
+  }
+
+  template<auto First, auto... Rest>
+  requires(path_detail::isCtPathSegmentValue<First> && (... && path_detail::isCtPathSegmentValue<Rest>) )
+  constexpr decltype(auto) get() const {
+    return path_detail::ctPathGet<decltype(*this), First, Rest...>(*this);
+  }
+
+  constexpr auto indexLookup(std::size_t idx) const -> ValueRef {
+    if (idx >= N) {
+      return ValueRef{};
+    }
+    return ValueRef::from(elements[idx]);
+  }
+
+  constexpr auto begin() const -> Iterator { return Iterator{this, 0}; }
+  constexpr auto end() const -> Iterator { return Iterator{this, N}; }
+};
+
 template<typename Rep, auto... Keys>
 struct TableObject: Rep {
   using TomlTableTag  = void;
@@ -108,7 +178,10 @@ struct TableObject: Rep {
     TableObject const* owner = nullptr;
     std::size_t        index = 0;
 
-    constexpr auto operator*() const -> Entry { return Entry{owner->keyAt(index), owner->valueAt(index)}; }
+    constexpr auto operator*() const -> Entry {
+      auto const& accessor = accessors()[index];
+      return Entry{accessor.key, accessor.value(*owner)};
+    }
     constexpr auto operator++() -> Iterator& {
       ++index;
       return *this;
@@ -120,6 +193,7 @@ struct TableObject: Rep {
 
   static constexpr auto keyNames = std::array<std::string_view, sizeof...(Keys)>{std::string_view{Keys}...};
 
+  constexpr TableObject() = default;
   constexpr explicit TableObject(Rep value): Rep(value) {}
 
   static consteval auto staticSize() -> std::size_t {
@@ -136,17 +210,31 @@ struct TableObject: Rep {
     return keyNames[I];
   }
 
+  // Position of `key` in `keyNames` through the perfect hash, or `keyNames.size()` when absent.
+  static constexpr auto indexOf(std::string_view key) -> std::size_t { return keyIndex().find(keyNames, key); }
+
   constexpr auto lookupKey(std::string_view key) const -> ValueRef {
-    auto           out = ValueRef{};
-    std::size_t    i   = 0;
-    constexpr auto ctx = meta::access_context::current();
-    template for (constexpr auto m: define_static_array(nonstatic_data_members_of(^^Rep, ctx))) {
-      if (!out.valid() && i < keyNames.size() && keyNames[i] == key) {
-        out = ValueRef::from(this->[:m:]);
-      }
-      ++i;
+    auto const idx = indexOf(key);
+    if (idx >= keyNames.size()) {
+      return ValueRef{};
+    }
+    return accessors()[idx].value(*this);
+  }
+
+  constexpr auto indexLookup(std::size_t idx) const -> ValueRef {
+    if (idx >= keyNames.size()) {
+      return ValueRef{};
+    }
+    return accessors()[idx].value(*this);
+  }
+
+  // Visits every entry in declaration order with one accessor call each; `ValueRef` iteration and JSON/TOML
+  // emission go through here.
+  template<typename Visit>
+  constexpr auto forEach(Visit&& visit) const -> void {
+    for (auto const& accessor: accessors()) {
+      visit(accessor.key, accessor.value(*this));
     }
-    return out;
   }
 
   constexpr auto operator[](std::string_view key) const -> ValueRef { return lookupKey(key); }
@@ -211,26 +299,37 @@ struct TableObject: Rep {
   constexpr auto end() const -> Iterator { return Iterator{this, keyNames.size()}; }
 
  private:
-  constexpr auto keyAt(std::size_t idx) const -> std::string_view {
-    if (idx >= keyNames.size()) {
-      return {};
-    }
-    return keyNames[idx];
-  }
+  using ValueThunk = ValueRef (*)(TableObject const&);
+
+  // One (key, accessor) pair per member, in member order, so entry `i` costs one indirect call.
+  struct Accessor {
+    std::string_view key{};
+    ValueThunk       value = nullptr;
+  };
 
-  constexpr auto valueAt(std::size_t idx) const -> ValueRef {
-    auto           out = ValueRef{};
+  static consteval auto makeAccessors() -> std::array<Accessor, sizeof...(Keys)> {
+    auto           out = std::array<Accessor, sizeof...(Keys)>{};
     std::size_t    i   = 0;
     constexpr auto ctx = meta::access_context::current();
     template for (constexpr auto m: define_static_array(nonstatic_data_members_of(^^Rep, ctx))) {
-      if (!out.valid() && i == idx) {
-        out = ValueRef::from(this->[:m:]);
+      if (i < out.size()) {
+        out[i] = Accessor{keyNames[i], [](TableObject const& self) -> ValueRef { return ValueRef::from(self.[:m:]); }};
       }
       ++i;
     }
     return out;
   }
 
+  static constexpr auto keyIndex() -> hash_detail::KeyIndex<sizeof...(Keys)> const& {
+    static constexpr auto index = hash_detail::buildKeyIndex(keyNames);
+    return index;
+  }
+
+  static constexpr auto accessors() -> std::array<Accessor, sizeof...(Keys)> const& {
+    static constexpr auto table = makeAccessors();
+    return table;
+  }
+
   template<std::size_t I, std::size_t J>
   constexpr decltype(auto) getByIndexImpl() const {
     constexpr auto ctx     = meta::access_context::current();
@@ -268,6 +367,7 @@ struct TableObject: Rep {
 
 template<typename Rep>
 struct RootObject: Rep {
+  constexpr RootObject() = default;
   constexpr explicit RootObject(Rep value): Rep(value) {}
 
   static consteval auto indices() {
@@ -22,6 +22,47 @@ enum class ParseError : std::uint8_t {
   unsupportedValue,
 };
 
+struct NameIndex {
+  std::vector<std::size_t> slots{};
+  std::size_t              count = 0;
+
+  consteval auto contains(std::vector<std::string> const& names, std::string_view name) const -> bool {
+    if (slots.empty()) {
+      return false;
+    }
+    auto const mask = slots.size() - 1;
+    for (auto slot = static_cast<std::size_t>(hash_detail::hashKey(name)) & mask;; slot = (slot + 1) & mask) {
+      if (slots[slot] == 0) {
+        return false;
+      }
+      if (names[slots[slot] - 1] == name) {
+        return true;
+      }
+    }
+  }
+
+  consteval auto insert(std::vector<std::string> const& names, std::size_t position) -> void {
+    if ((count + 1) * 2 > slots.size()) {
+      slots.assign(slots.empty() ? 16 : slots.size() * 2, 0);
+      for (std::size_t i = 0; i < count; ++i) {
+        place(names, i);
+      }
+    }
+    place(names, position);
+    ++count;
+  }
+
+ private:
+  consteval auto place(std::vector<std::string> const& names, std::size_t position) -> void {
+    auto const mask = slots.size() - 1;
+    auto       slot = static_cast<std::size_t>(hash_detail::hashKey(names[position])) & mask;
+    while (slots[slot] != 0) {
+      slot = (slot + 1) & mask;
+    }
+    slots[slot] = position + 1;
+  }
+};
+
 struct ParseOutput {
   struct MetaEntrySpec {
     std::string path{};
@@ -40,6 +81,8 @@ struct ParseOutput {
   std::vector<meta::info>               values{};
   std::vector<std::string>              keys{};
   std::vector<std::string>              memberNames{};
+  NameIndex                             keyIndex{};
+  NameIndex                             memberNameIndex{};
   std::vector<ValueType>                types{};
   std::vector<bool>                     inlineTables{};
   std::vector<std::vector<std::string>> leadingComments{};
@@ -81,12 +124,7 @@ consteval auto startsWithPath(std::vector<std::string> const& whole, std::vector
 }
 
 consteval auto containsKey(ParseOutput const& out, std::string_view key) -> bool {
-  for (auto const& k: out.keys) {
-    if (k == key) {
-      return true;
-    }
-  }
-  return false;
+  return out.keyIndex.contains(out.keys, key);
 }
 
 consteval auto findTableByName(std::vector<NamedTableOutput> const& tables, std::string_view key) -> std::size_t {
@@ -161,14 +199,14 @@ consteval auto skipLine(std::string_view s, std::size_t pos) -> std::size_t {
   return pos;
 }
 
-consteval auto skipInlineWs(std::string_view s, std::size_t pos) -> std::size_t {
+constexpr auto skipInlineWs(std::string_view s, std::size_t pos) -> std::size_t {
   while (pos < s.size() && isWs(s[pos])) {
     ++pos;
   }
   return pos;
 }
 
-consteval auto trimRight(std::string_view s) -> std::string_view {
+constexpr auto trimRight(std::string_view s) -> std::string_view {
   auto end = s.size();
   while (end > 0 && isWs(s[end - 1])) {
     --end;
@@ -248,7 +286,7 @@ consteval auto makeArrayMemberName(std::size_t idx) -> std::string {
   return out;
 }
 
-consteval auto parseUnsigned(std::string_view s, unsigned& out) -> bool {
+constexpr auto parseUnsigned(std::string_view s, unsigned& out) -> bool {
   if (s.empty()) {
     return false;
   }
@@ -263,139 +301,12 @@ consteval auto parseUnsigned(std::string_view s, unsigned& out) -> bool {
   return true;
 }
 
-constexpr auto isUtf8Cont(unsigned char c) -> bool {
-  return c >= 0x80U && c <= 0xBFU;
-}
-
-constexpr auto isWellFormedUtf8(std::string_view s) -> bool {
-  std::size_t i = 0;
-  while (i < s.size()) {
-    auto const b0 = static_cast<unsigned char>(s[i]);
-    if (b0 <= 0x7FU) {
-      ++i;
-      continue;
-    }
-    if (b0 >= 0xC2U && b0 <= 0xDFU) {
-      if (i + 1 >= s.size()) {
-        return false;
-      }
-      auto const b1 = static_cast<unsigned char>(s[i + 1]);
-      if (!isUtf8Cont(b1)) {
-        return false;
-      }
-      i += 2;
-      continue;
-    }
-    if (b0 == 0xE0U) {
-      if (i + 2 >= s.size()) {
-        return false;
-      }
-      auto const b1 = static_cast<unsigned char>(s[i + 1]);
-      auto const b2 = static_cast<unsigned char>(s[i + 2]);
-      if (!(b1 >= 0xA0U && b1 <= 0xBFU) || !isUtf8Cont(b2)) {
-        return false;
-      }
-      i += 3;
-      continue;
-    }
-    if (b0 >= 0xE1U && b0 <= 0xECU) {
-      if (i + 2 >= s.size()) {
-        return false;
-      }
-      auto const b1 = static_cast<unsigned char>(s[i + 1]);
-      auto const b2 = static_cast<unsigned char>(s[i + 2]);
-      if (!isUtf8Cont(b1) || !isUtf8Cont(b2)) {
-        return false;
-      }
-      i += 3;
-      continue;
-    }
-    if (b0 == 0xEDU) {
-      if (i + 2 >= s.size()) {
-        return false;
-      }
-      auto const b1 = static_cast<unsigned char>(s[i + 1]);
-      auto const b2 = static_cast<unsigned char>(s[i + 2]);
-      if (!(b1 >= 0x80U && b1 <= 0x9FU) || !isUtf8Cont(b2)) {
-        return false;
-      }
-      i += 3;
-      continue;
-    }
-    if (b0 >= 0xEEU && b0 <= 0xEFU) {
-      if (i + 2 >= s.size()) {
-        return false;
-      }
-      auto const b1 = static_cast<unsigned char>(s[i + 1]);
-      auto const b2 = static_cast<unsigned char>(s[i + 2]);
-      if (!isUtf8Cont(b1) || !isUtf8Cont(b2)) {
-        return false;
-      }
-      i += 3;
-      continue;
-    }
-    if (b0 == 0xF0U) {
-      if (i + 3 >= s.size()) {
-        return false;
-      }
-      auto const b1 = static_cast<unsigned char>(s[i + 1]);
-      auto const b2 = static_cast<unsigned char>(s[i + 2]);
-      auto const b3 = static_cast<unsigned char>(s[i + 3]);
-      if (!(b1 >= 0x90U && b1 <= 0xBFU) || !isUtf8Cont(b2) || !isUtf8Cont(b3)) {
-        return false;
-      }
-      i += 4;
-      continue;
-    }
-    if (b0 >= 0xF1U && b0 <= 0xF3U) {
-      if (i + 3 >= s.size()) {
-        return false;
-      }
-      auto const b1 = static_cast<unsigned char>(s[i + 1]);
-      auto const b2 = static_cast<unsigned char>(s[i + 2]);
-      auto const b3 = static_cast<unsigned char>(s[i + 3]);
-      if (!isUtf8Cont(b1) || !isUtf8Cont(b2) || !isUtf8Cont(b3)) {
-        return false;
-      }
-      i += 4;
-      continue;
-    }
-    if (b0 == 0xF4U) {
-      if (i + 3 >= s.size()) {
-        return false;
-      }
-      auto const b1 = static_cast<unsigned char>(s[i + 1]);
-      auto const b2 = static_cast<unsigned char>(s[i + 2]);
-      auto const b3 = static_cast<unsigned char>(s[i + 3]);
-      if (!(b1 >= 0x80U && b1 <= 0x8FU) || !isUtf8Cont(b2) || !isUtf8Cont(b3)) {
-        return false;
-      }
-      i += 4;
-      continue;
-    }
-    return false;
-  }
-  return true;
-}
-
-constexpr auto hasOnlyLfOrCrlf(std::string_view s) -> bool {
-  for (std::size_t i = 0; i < s.size(); ++i) {
-    if (s[i] == '\r') {
-      if (i + 1 >= s.size() || s[i + 1] != '\n') {
-        return false;
-      }
-      ++i;
-    }
-  }
-  return true;
-}
-
 constexpr auto isDisallowedCommentControl(char c) -> bool {
   auto const uc = static_cast<unsigned char>(c);
   return uc <= 0x08U || (uc >= 0x0AU && uc <= 0x1FU) || uc == 0x7FU;
 }
 
-consteval auto digitValue(char c) -> int {
+constexpr auto digitValue(char c) -> int {
   if (c >= '0' && c <= '9') {
     return c - '0';
   }
@@ -408,11 +319,13 @@ consteval auto digitValue(char c) -> int {
   return -1;
 }
 
-consteval auto parseUnderscoredUnsigned(std::string_view s, unsigned base, unsigned long long& out, unsigned& digits)
+constexpr auto parseUnderscoredUnsigned(std::string_view s, unsigned base, unsigned long long& out, unsigned& digits)
   -> bool {
   if (s.empty()) {
     return false;
   }
+  constexpr auto     max            = std::numeric_limits<unsigned long long>::max();
+  auto const         limit          = max / base;
   unsigned long long value          = 0;
   bool               prevUnderscore = false;
   digits                            = 0;
@@ -428,7 +341,7 @@ consteval auto parseUnderscoredUnsigned(std::string_view s, unsigned base, unsig
     if (d < 0 || static_cast<unsigned>(d) >= base) {
       return false;
     }
-    if (value > (std::numeric_limits<unsigned long long>::max() - static_cast<unsigned long long>(d)) / base) {
+    if (value > limit || value * base > max - static_cast<unsigned long long>(d)) {
       return false;
     }
     value          = value * base + static_cast<unsigned long long>(d);
@@ -442,7 +355,7 @@ consteval auto parseUnderscoredUnsigned(std::string_view s, unsigned base, unsig
   return true;
 }
 
-consteval auto parseSpecialFloat(std::string_view s, double& out) -> bool {
+constexpr auto parseSpecialFloat(std::string_view s, double& out) -> bool {
   if (s == "inf" || s == "+inf") {
     out = std::numeric_limits<double>::infinity();
     return true;
@@ -462,7 +375,7 @@ consteval auto parseSpecialFloat(std::string_view s, double& out) -> bool {
   return false;
 }
 
-consteval auto parseInt64(std::string_view s, std::int64_t& out) -> bool {
+constexpr auto parseInt64(std::string_view s, std::int64_t& out) -> bool {
   if (s.empty()) {
     return false;
   }
@@ -532,15 +445,7 @@ consteval auto parseInt64(std::string_view s, std::int64_t& out) -> bool {
   return true;
 }
 
-consteval auto pow10i(unsigned n) -> double {
-  double v = 1.0;
-  for (unsigned i = 0; i < n; ++i) {
-    v *= 10.0;
-  }
-  return v;
-}
-
-consteval auto parseFloat64(std::string_view s, double& out) -> bool {
+constexpr auto parseFloat64(std::string_view s, double& out) -> bool {
   if (s.empty()) {
     return false;
   }
@@ -558,23 +463,20 @@ consteval auto parseFloat64(std::string_view s, double& out) -> bool {
     return false;
   }
 
+  auto       decimal  = float_detail::Decimal{};
   auto const intStart = pos;
   while (pos < s.size() && (s[pos] == '_' || (s[pos] >= '0' && s[pos] <= '9'))) {
     ++pos;
   }
-  auto const         intPart     = s.substr(intStart, pos - intStart);
-  unsigned long long integerPart = 0;
-  unsigned           intDigits   = 0;
-  if (!parseUnderscoredUnsigned(intPart, 10, integerPart, intDigits)) {
+  decimal.integer = s.substr(intStart, pos - intStart);
+  if (!float_detail::accumulateDigits(decimal, decimal.integer, false)) {
     return false;
   }
-  if (intDigits > 1 && intPart.front() == '0') {
+  if (decimal.integer.size() > 1 && decimal.integer.front() == '0') {
     return false;
   }
 
-  unsigned long long fracPart   = 0;
-  unsigned           fracDigits = 0;
-  bool               hasDot     = false;
+  bool hasDot = false;
   if (pos < s.size() && s[pos] == '.') {
     hasDot = true;
     ++pos;
@@ -582,8 +484,8 @@ consteval auto parseFloat64(std::string_view s, double& out) -> bool {
     while (pos < s.size() && (s[pos] == '_' || (s[pos] >= '0' && s[pos] <= '9'))) {
       ++pos;
     }
-    auto const fracStr = s.substr(fracStart, pos - fracStart);
-    if (!parseUnderscoredUnsigned(fracStr, 10, fracPart, fracDigits)) {
+    decimal.fraction = s.substr(fracStart, pos - fracStart);
+    if (!float_detail::accumulateDigits(decimal, decimal.fraction, true)) {
       return false;
     }
   }
@@ -592,12 +494,11 @@ consteval auto parseFloat64(std::string_view s, double& out) -> bool {
     return false;
   }
 
-  int  expSign = 1;
-  int  exp     = 0;
-  bool hasExp  = false;
+  bool hasExp = false;
   if (pos < s.size() && (s[pos] == 'e' || s[pos] == 'E')) {
     hasExp = true;
     ++pos;
+    int expSign = 1;
     if (pos < s.size() && (s[pos] == '+' || s[pos] == '-')) {
       expSign = (s[pos] == '-') ? -1 : 1;
       ++pos;
@@ -617,7 +518,8 @@ consteval auto parseFloat64(std::string_view s, double& out) -> bool {
     if (expMag > static_cast<unsigned long long>(std::numeric_limits<int>::max())) {
       return false;
     }
-    exp = static_cast<int>(expMag);
+    decimal.explicitExponent = expSign * static_cast<std::int64_t>(expMag);
+    decimal.exponent += decimal.explicitExponent;
   }
 
   if (!hasDot && !hasExp) {
@@ -628,22 +530,11 @@ consteval auto parseFloat64(std::string_view s, double& out) -> bool {
     return false;
   }
 
-  auto value = static_cast<double>(integerPart);
-  if (fracDigits > 0) {
-    value += static_cast<double>(fracPart) / pow10i(fracDigits);
-  }
-  if (exp != 0) {
-    if (expSign > 0) {
-      value *= pow10i(static_cast<unsigned>(exp));
-    } else {
-      value /= pow10i(static_cast<unsigned>(exp));
-    }
-  }
-  out = neg ? -value : value;
+  out = float_detail::toDouble(float_detail::decimalToBinary(decimal), neg);
   return true;
 }
 
-consteval auto hexDigitValue(char c) -> int {
+constexpr auto hexDigitValue(char c) -> int {
   if (c >= '0' && c <= '9') {
     return c - '0';
   }
@@ -656,7 +547,7 @@ consteval auto hexDigitValue(char c) -> int {
   return -1;
 }
 
-consteval auto parseHexN(std::string_view s, unsigned& out) -> bool {
+constexpr auto parseHexN(std::string_view s, unsigned& out) -> bool {
   if (s.empty()) {
     return false;
   }
@@ -672,7 +563,8 @@ consteval auto parseHexN(std::string_view s, unsigned& out) -> bool {
   return true;
 }
 
-consteval auto appendUtf8Codepoint(std::string& out, unsigned cp) -> bool {
+template<typename String>
+constexpr auto appendUtf8Codepoint(String& out, unsigned cp) -> bool {
   if (cp > 0x10FFFFU) {
     return false;
   }
@@ -701,7 +593,7 @@ consteval auto appendUtf8Codepoint(std::string& out, unsigned cp) -> bool {
   return true;
 }
 
-consteval auto isDisallowedStringControl(char c, bool allowNewline) -> bool {
+constexpr auto isDisallowedStringControl(char c, bool allowNewline) -> bool {
   auto const uc = static_cast<unsigned char>(c);
   if (uc == 0x09U) {
     return false;
@@ -715,7 +607,17 @@ consteval auto isDisallowedStringControl(char c, bool allowNewline) -> bool {
   return false;
 }
 
-consteval auto consumeTomlStringToken(std::string_view sv, std::size_t start, bool allowMultiline, std::size_t& next)
+// End of the closing delimiter of a multiline string whose quote run starts at `i`, or 0 when the run is shorter
+// than three. Up to two quotes right before the delimiter belong to the body, so a run of four or five still closes.
+constexpr auto multilineStringEnd(std::string_view sv, std::size_t i, char quote) -> std::size_t {
+  auto run = std::size_t{0};
+  while (i + run < sv.size() && run < 5 && sv[i + run] == quote) {
+    ++run;
+  }
+  return run >= 3 ? i + run : 0;
+}
+
+constexpr auto consumeTomlStringToken(std::string_view sv, std::size_t start, bool allowMultiline, std::size_t& next)
   -> bool {
   if (start >= sv.size()) {
     return false;
@@ -742,9 +644,11 @@ consteval auto consumeTomlStringToken(std::string_view sv, std::size_t start, bo
       continue;
     }
     if (multiline) {
-      if (i + 2 < sv.size() && c == quote && sv[i + 1] == quote && sv[i + 2] == quote) {
-        next = i + 3;
-        return true;
+      if (c == quote) {
+        if (auto const end = multilineStringEnd(sv, i, quote); end != 0) {
+          next = end;
+          return true;
+        }
       }
     } else if (c == quote) {
       next = i + 1;
@@ -755,7 +659,8 @@ consteval auto consumeTomlStringToken(std::string_view sv, std::size_t start, bo
   return false;
 }
 
-consteval auto parseQuotedString(std::string_view in, std::string& out, bool allowMultiline = true) -> bool {
+constexpr auto quotedStringBody(std::string_view in, bool allowMultiline, std::string_view& body, bool& multiline)
+  -> bool {
   if (in.size() < 2) {
     return false;
   }
@@ -764,16 +669,13 @@ consteval auto parseQuotedString(std::string_view in, std::string& out, bool all
     return false;
   }
 
-  bool const multiline =
+  multiline =
     in.size() >= 6 && in[1] == quote && in[2] == quote && in[in.size() - 2] == quote && in[in.size() - 3] == quote;
   if (multiline && !allowMultiline) {
     return false;
   }
-  if (!multiline && in.size() < 2) {
-    return false;
-  }
 
-  auto body = multiline ? in.substr(3, in.size() - 6) : in.substr(1, in.size() - 2);
+  body = multiline ? in.substr(3, in.size() - 6) : in.substr(1, in.size() - 2);
   if (multiline) {
     if (body.size() >= 2 && body[0] == '\r' && body[1] == '\n') {
       body.remove_prefix(2);
@@ -781,10 +683,46 @@ consteval auto parseQuotedString(std::string_view in, std::string& out, bool all
       body.remove_prefix(1);
     }
   }
+  return true;
+}
+
+constexpr auto borrowQuotedString(std::string_view in, std::string_view& out, bool allowMultiline = true) -> bool {
+  auto body      = std::string_view{};
+  bool multiline = false;
+  if (!quotedStringBody(in, allowMultiline, body, multiline)) {
+    return false;
+  }
+  bool const basic = in.front() == '"';
+  for (char const c: body) {
+    if (c == '\r' || (basic && c == '\\') || isDisallowedStringControl(c, multiline)) {
+      return false;
+    }
+  }
+  out = body;
+  return true;
+}
+
+template<typename String>
+constexpr auto parseQuotedString(std::string_view in, String& out, bool allowMultiline = true) -> bool {
+  auto body      = std::string_view{};
+  bool multiline = false;
+  if (!quotedStringBody(in, allowMultiline, body, multiline)) {
+    return false;
+  }
+  auto const quote = in.front();
 
   out.clear();
+  out.reserve(body.size());
   std::size_t i = 0;
   while (i < body.size()) {
+    auto const runStart = i;
+    while (i < body.size() && body[i] != '\\' && body[i] != '\r' && !isDisallowedStringControl(body[i], multiline)) {
+      ++i;
+    }
+    out.append(body.substr(runStart, i - runStart));
+    if (i >= body.size()) {
+      break;
+    }
     auto const c = body[i];
     if (quote == '"' && c == '\\') {
       if (i + 1 >= body.size()) {
@@ -898,7 +836,7 @@ consteval auto parseQuotedString(std::string_view in, std::string& out, bool all
   return true;
 }
 
-consteval auto parseLocalDate(std::string_view s, LocalDate& out) -> bool {
+constexpr auto parseLocalDate(std::string_view s, LocalDate& out) -> bool {
   if (s.size() != 10 || s[4] != '-' || s[7] != '-') {
     return false;
   }
@@ -911,10 +849,10 @@ consteval auto parseLocalDate(std::string_view s, LocalDate& out) -> bool {
   if (m == 0 || m > 12) {
     return false;
   }
-  auto const isLeapYear = [](unsigned year) consteval {
+  auto const isLeapYear = [](unsigned year) constexpr {
     return (year % 4U == 0U) && ((year % 100U != 0U) || (year % 400U == 0U));
   };
-  auto const maxDay = [&]() consteval -> unsigned {
+  auto const maxDay = [&]() constexpr -> unsigned {
     switch (m) {
     case 2 : return isLeapYear(y) ? 29U : 28U;
     case 4 :
@@ -931,7 +869,7 @@ consteval auto parseLocalDate(std::string_view s, LocalDate& out) -> bool {
   return true;
 }
 
-consteval auto parseLocalTime(std::string_view s, LocalTime& out) -> bool {
+constexpr auto parseLocalTime(std::string_view s, LocalTime& out) -> bool {
   if (s.size() < 5 || s[2] != ':') {
     return false;
   }
@@ -993,7 +931,7 @@ consteval auto parseLocalTime(std::string_view s, LocalTime& out) -> bool {
   return true;
 }
 
-consteval auto parseDateOrDateTime(
+constexpr auto parseDateOrDateTime(
   std::string_view s,
   LocalDate&       date,
   LocalTime&       time,
@@ -1052,6 +990,65 @@ consteval auto parseDateOrDateTime(
   return true;
 }
 
+struct ScalarToken {
+  ValueType    type          = ValueType::none;
+  bool         boolean       = false;
+  std::int64_t integer       = 0;
+  double       floating      = 0.0;
+  LocalDate    date          = {};
+  LocalTime    time          = {};
+  int          offsetMinutes = 0;
+};
+
+constexpr auto parseScalarToken(std::string_view raw, ScalarToken& out) -> ParseError {
+  if (raw == "true" || raw == "false") {
+    out.type    = ValueType::boolean;
+    out.boolean = raw == "true";
+    return ParseError::none;
+  }
+
+  if (raw.size() >= 10 && raw[4] == '-' && raw[7] == '-') {
+    bool hasTime   = false;
+    bool hasOffset = false;
+    if (!parseDateOrDateTime(raw, out.date, out.time, hasTime, out.offsetMinutes, hasOffset)) {
+      return (raw.size() == 10) ? ParseError::invalidDate : ParseError::invalidDateTime;
+    }
+    if (!hasTime) {
+      out.type = ValueType::localDate;
+    } else if (hasOffset) {
+      out.type = ValueType::offsetDateTime;
+    } else {
+      out.type = ValueType::localDateTime;
+    }
+    return ParseError::none;
+  }
+
+  if (raw.find(':') != std::string_view::npos) {
+    if (!parseLocalTime(raw, out.time)) {
+      return ParseError::invalidTime;
+    }
+    out.type = ValueType::localTime;
+    return ParseError::none;
+  }
+
+  if (parseInt64(raw, out.integer)) {
+    out.type = ValueType::integer;
+    return ParseError::none;
+  }
+
+  if (parseFloat64(raw, out.floating)) {
+    out.type = ValueType::floating;
+    return ParseError::none;
+  }
+
+  if (raw.find_first_of(".eE") != std::string_view::npos
+      || raw.find("inf") != std::string_view::npos
+      || raw.find("nan") != std::string_view::npos) {
+    return ParseError::invalidFloat;
+  }
+  return ParseError::invalidInteger;
+}
+
 consteval auto parseInlineTable(std::string_view raw) -> InlineParseResult;
 consteval auto parseScalarArray(std::string_view raw) -> ArrayParseResult;
 
@@ -1067,9 +1064,15 @@ consteval auto isLegalMemberName(std::string_view key) -> bool {
   return true;
 }
 
+template<std::size_t N>
+consteval auto sortedNames(std::array<std::string_view, N> names) -> std::array<std::string_view, N> {
+  std::ranges::sort(names);
+  return names;
+}
+
 consteval auto shouldExcludeKey(std::string_view key) -> bool {
   auto const isCpp26Keyword = [](std::string_view value) consteval {
-    constexpr auto keywords = std::array{
+    constexpr auto keywords = sortedNames(std::to_array<std::string_view>({
       "alignas",
       "alignof",
       "and",
@@ -1170,16 +1173,18 @@ consteval auto shouldExcludeKey(std::string_view key) -> bool {
       "while",
       "xor",
       "xor_eq",
-    };
-    return std::ranges::find(keywords, value) != keywords.end();
+    }));
+    return std::ranges::binary_search(keywords, value);
   };
 
   auto const isMemberFunctionConflict = [](std::string_view value) consteval {
     constexpr auto conflicts = std::array{
       "begin",
       "end",
+      "forEach",
       "get",
       "indexLookup",
+      "indexOf",
       "indices",
       "key",
       "lookupKey",
@@ -1286,25 +1291,19 @@ consteval auto parseKeyPath(std::vector<std::string>& path) {
 
 consteval auto pushDuplicateChecked(ParseOutput& out, std::string const& key, meta::info member, meta::info value)
   -> bool {
-  for (auto const& k: out.keys) {
-    if (k == key) {
-      out.error = ParseError::duplicateKey;
-      return false;
-    }
+  if (containsKey(out, key)) {
+    out.error = ParseError::duplicateKey;
+    return false;
   }
   out.keys.emplace_back(key);
+  out.keyIndex.insert(out.keys, out.keys.size() - 1);
   out.members.emplace_back(member);
   out.values.emplace_back(value);
   return true;
 }
 
 consteval auto containsMemberName(ParseOutput const& out, std::string_view memberName) -> bool {
-  for (auto const& name: out.memberNames) {
-    if (name == memberName) {
-      return true;
-    }
-  }
-  return false;
+  return out.memberNameIndex.contains(out.memberNames, memberName);
 }
 
 consteval auto assignMemberName(ParseOutput& out, std::string const& key) -> std::string {
@@ -1329,16 +1328,16 @@ consteval auto pushField(
   std::vector<std::string> leadingComments  = {},
   std::vector<std::string> trailingComments = {}
 ) -> bool {
-  for (auto const& k: out.keys) {
-    if (k == key) {
-      out.error = ParseError::duplicateKey;
-      return false;
-    }
+  if (containsKey(out, key)) {
+    out.error = ParseError::duplicateKey;
+    return false;
   }
   auto const memberName = assignMemberName(out, key);
   auto const dms        = data_member_spec(memberType, {.name = memberName});
   out.keys.emplace_back(key);
+  out.keyIndex.insert(out.keys, out.keys.size() - 1);
   out.memberNames.emplace_back(memberName);
+  out.memberNameIndex.insert(out.memberNames, out.memberNames.size() - 1);
   out.types.emplace_back(valueType);
   out.inlineTables.emplace_back(inlineTable);
   out.leadingComments.emplace_back(std::move(leadingComments));
@@ -1427,122 +1426,50 @@ consteval auto parseScalarValue(
     );
   }
 
-  if (raw == "true" || raw == "false") {
-    auto const v = raw == "true";
-    return pushField(
-      out,
-      key,
-      ^^bool,
-      meta::reflect_constant(v),
-      ValueType::boolean,
-      false,
-      std::move(leadingComments),
-      std::move(trailingComments)
-    );
+  ScalarToken token{};
+  if (auto const error = parseScalarToken(raw, token); error != ParseError::none) {
+    out.error = error;
+    return false;
   }
-
-  if (raw.size() >= 10 && raw[4] == '-' && raw[7] == '-') {
-    LocalDate date{};
-    LocalTime time{};
-    bool      hasTime   = false;
-    int       offset    = 0;
-    bool      hasOffset = false;
-    if (!parseDateOrDateTime(raw, date, time, hasTime, offset, hasOffset)) {
-      out.error = (raw.size() == 10) ? ParseError::invalidDate : ParseError::invalidDateTime;
-      return false;
-    }
-    if (!hasTime) {
-      return pushField(
-        out,
-        key,
-        ^^LocalDate,
-        meta::reflect_constant(date),
-        ValueType::localDate,
-        false,
-        std::move(leadingComments),
-        std::move(trailingComments)
-      );
-    }
-    if (hasOffset) {
-      auto odt = OffsetDateTime{date, time, offset};
-      return pushField(
-        out,
-        key,
-        ^^OffsetDateTime,
-        meta::reflect_constant(odt),
-        ValueType::offsetDateTime,
-        false,
-        std::move(leadingComments),
-        std::move(trailingComments)
-      );
-    }
-    auto ldt = LocalDateTime{date, time};
+  auto const push = [&](meta::info memberType, meta::info value) consteval -> bool {
     return pushField(
-      out,
-      key,
-      ^^LocalDateTime,
-      meta::reflect_constant(ldt),
-      ValueType::localDateTime,
-      false,
-      std::move(leadingComments),
-      std::move(trailingComments)
+      out, key, memberType, value, token.type, false, std::move(leadingComments), std::move(trailingComments)
     );
+  };
+  switch (token.type) {
+  case ValueType::boolean  : return push(^^bool, meta::reflect_constant(token.boolean));
+  case ValueType::floating : return push(^^double, meta::reflect_constant(token.floating));
+  case ValueType::integer  : return push(^^long long, meta::reflect_constant(token.integer));
+  case ValueType::localDate: return push(^^LocalDate, meta::reflect_constant(token.date));
+  case ValueType::localTime: return push(^^LocalTime, meta::reflect_constant(token.time));
+  case ValueType::localDateTime: {
+    auto const ldt = LocalDateTime{token.date, token.time};
+    return push(^^LocalDateTime, meta::reflect_constant(ldt));
   }
-
-  if (raw.find(':') != std::string_view::npos) {
-    LocalTime lt{};
-    if (!parseLocalTime(raw, lt)) {
-      out.error = ParseError::invalidTime;
-      return false;
-    }
-    return pushField(
-      out,
-      key,
-      ^^LocalTime,
-      meta::reflect_constant(lt),
-      ValueType::localTime,
-      false,
-      std::move(leadingComments),
-      std::move(trailingComments)
-    );
+  default: {
+    auto const odt = OffsetDateTime{token.date, token.time, token.offsetMinutes};
+    return push(^^OffsetDateTime, meta::reflect_constant(odt));
   }
-
-  double f = 0.0;
-  if (parseFloat64(raw, f)) {
-    return pushField(
-      out,
-      key,
-      ^^double,
-      meta::reflect_constant(f),
-      ValueType::floating,
-      false,
-      std::move(leadingComments),
-      std::move(trailingComments)
-    );
   }
+}
 
-  std::int64_t i = 0;
-  if (parseInt64(raw, i)) {
-    return pushField(
-      out,
-      key,
-      ^^long long,
-      meta::reflect_constant(i),
-      ValueType::integer,
-      false,
-      std::move(leadingComments),
-      std::move(trailingComments)
-    );
+consteval auto homogeneousScalarType(ParseOutput const& out) -> meta::info {
+  if (out.types.empty()) {
+    return ^^void;
   }
-
-  if (raw.find_first_of(".eE") != std::string_view::npos
-      || raw.find("inf") != std::string_view::npos
-      || raw.find("nan") != std::string_view::npos) {
-    out.error = ParseError::invalidFloat;
-  } else {
-    out.error = ParseError::invalidInteger;
+  auto const type = out.types.front();
+  for (auto const t: out.types) {
+    if (t != type) {
+      return ^^void;
+    }
+  }
+  switch (type) {
+  case ValueType::integer : return ^^std::int64_t;
+  case ValueType::floating: return ^^double;
+  case ValueType::boolean : return ^^bool;
+  case ValueType::string  : return ^^char const*;
+  default                 : return ^^void;
   }
-  return false;
 }
 
 consteval auto parseScalarArray(std::string_view raw) -> ArrayParseResult {
@@ -1602,6 +1529,8 @@ consteval auto parseScalarArray(std::string_view raw) -> ArrayParseResult {
     merged.values           = base.values;
     merged.keys             = base.keys;
     merged.memberNames      = base.memberNames;
+    merged.keyIndex         = base.keyIndex;
+    merged.memberNameIndex  = base.memberNameIndex;
     merged.types            = base.types;
     merged.inlineTables     = base.inlineTables;
     merged.leadingComments  = base.leadingComments;
@@ -1719,6 +1648,18 @@ consteval auto parseScalarArray(std::string_view raw) -> ArrayParseResult {
     return result;
   }
 
+  if (auto const elementType = homogeneousScalarType(local); elementType != ^^void) {
+    std::vector<meta::info> storageArgs{};
+    storageArgs.emplace_back(elementType);
+    storageArgs.emplace_back(meta::reflect_constant(local.keys.size()));
+    result.type = substitute(^^ScalarArrayObject, storageArgs);
+    std::vector<meta::info> elementArgs{};
+    elementArgs.emplace_back(result.type);
+    elementArgs.insert(elementArgs.end(), local.values.begin() + 1, local.values.end());
+    result.value = substitute(^^constructFrom, elementArgs);
+    return result;
+  }
+
   result.value = materialize(materialize, local, localChildren);
   std::vector<meta::info> arrayTypeArgs{};
   arrayTypeArgs.emplace_back(type_of(result.value));
@@ -1912,6 +1853,8 @@ consteval auto parseInlineTable(std::string_view raw) -> InlineParseResult {
     merged.values           = base.values;
     merged.keys             = base.keys;
     merged.memberNames      = base.memberNames;
+    merged.keyIndex         = base.keyIndex;
+    merged.memberNameIndex  = base.memberNameIndex;
     merged.types            = base.types;
     merged.inlineTables     = base.inlineTables;
     merged.leadingComments  = base.leadingComments;
@@ -2545,6 +2488,8 @@ consteval auto parseRootKv(std::string_view src) -> ParseOutput {
     merged.values           = base.values;
     merged.keys             = base.keys;
     merged.memberNames      = base.memberNames;
+    merged.keyIndex         = base.keyIndex;
+    merged.memberNameIndex  = base.memberNameIndex;
     merged.types            = base.types;
     merged.inlineTables     = base.inlineTables;
     merged.leadingComments  = base.leadingComments;
@@ -2603,6 +2548,29 @@ consteval auto parseRootKv(std::string_view src) -> ParseOutput {
   return out;
 }
 
+constexpr auto parseErrorCode(ParseError error) -> std::string_view {
+  switch (error) {
+  case ParseError::none              : return "E_NONE";
+  case ParseError::malformedLine     : return "E_MLINE";
+  case ParseError::invalidNewline    : return "E_INL";
+  case ParseError::invalidComment    : return "E_ICOM";
+  case ParseError::invalidUtf8       : return "E_UTF8";
+  case ParseError::invalidKey        : return "E_IKEY";
+  case ParseError::duplicateKey      : return "E_DKEY";
+  case ParseError::invalidArray      : return "E_IARR";
+  case ParseError::invalidInlineTable: return "E_IINL";
+  case ParseError::invalidString     : return "E_ISTR";
+  case ParseError::invalidInteger    : return "E_IINT";
+  case ParseError::invalidFloat      : return "E_IFLT";
+  case ParseError::invalidBoolean    : return "E_IBOOL";
+  case ParseError::invalidDate       : return "E_IDATE";
+  case ParseError::invalidTime       : return "E_ITIME";
+  case ParseError::invalidDateTime   : return "E_IDT";
+  case ParseError::unsupportedValue  : return "E_UNSUP";
+  default                            : return "E_UNK";
+  }
+}
+
 template<ParseError E>
 consteval auto failParse() -> void {
   if constexpr (E == ParseError::malformedLine) {
@@ -2665,7 +2633,7 @@ consteval auto failParseValue() -> int {
   return 0;
 }
 
-consteval auto normalizeSourceView(std::string_view source) -> std::string_view {
+constexpr auto normalizeSourceView(std::string_view source) -> std::string_view {
   auto normalized = source;
   if (!normalized.empty() && normalized.back() == '\0') {
     normalized.remove_suffix(1);
@@ -2673,56 +2641,55 @@ consteval auto normalizeSourceView(std::string_view source) -> std::string_view
   return normalized;
 }
 
-template<FixedString Source>
-consteval auto parseErrorOfText() -> ParseError {
-  auto const normalized = normalizeSourceView(Source.view());
-  if (!hasOnlyLfOrCrlf(normalized)) {
+constexpr auto sourceError(std::string_view source) -> ParseError {
+  auto const check = scan_detail::checkSource(source);
+  if (check.loneCarriageReturn) {
     return ParseError::invalidNewline;
   }
-  if (!isWellFormedUtf8(normalized)) {
+  if (check.malformedUtf8) {
     return ParseError::invalidUtf8;
   }
-  auto const out = parseRootKv(normalized);
-  return out.error;
+  return ParseError::none;
+}
+
+consteval auto parseDocument(std::string_view source) -> ParseOutput {
+  auto const normalized = normalizeSourceView(source);
+  if (auto const error = sourceError(normalized); error != ParseError::none) {
+    auto out  = ParseOutput{};
+    out.error = error;
+    return out;
+  }
+  return parseRootKv(normalized);
+}
+
+template<FixedString Source>
+consteval auto parseErrorOfText() -> ParseError {
+  return parseDocument(Source.view()).error;
 }
 
 template<auto SourceBytes>
 consteval auto parseErrorOfBytes() -> ParseError {
   constexpr std::string_view sourceView{SourceBytes};
-  auto const                 normalized = normalizeSourceView(sourceView);
-  if (!hasOnlyLfOrCrlf(normalized)) {
-    return ParseError::invalidNewline;
-  }
-  if (!isWellFormedUtf8(normalized)) {
-    return ParseError::invalidUtf8;
-  }
-  auto const out = parseRootKv(normalized);
-  return out.error;
+  return parseDocument(sourceView).error;
 }
 }  // namespace detail
 
 using detail::operator|;
 
-template<class Pred>
-struct ThrowIfStep {
-  Pred        pred{};
-  std::string message{};
+struct CheckSourceStep {
+  std::string context{};
 
   consteval auto operator()(std::string_view sv) const -> std::string_view {
-    if (pred(sv)) {
-      throw message;
+    switch (detail::sourceError(sv)) {
+    case detail::ParseError::invalidNewline: throw context + ": invalid newline";
+    case detail::ParseError::invalidUtf8   : throw context + ": invalid utf8";
+    default                                : return sv;
     }
-    return sv;
   }
 };
 
-consteval auto hasInvalidNewline(std::string_view sv) -> bool { return !detail::hasOnlyLfOrCrlf(sv); }
-
-consteval auto hasInvalidUtf8(std::string_view sv) -> bool { return !detail::isWellFormedUtf8(sv); }
-
-template<class Pred>
-consteval auto throwIf(Pred pred, std::string message) {
-  return ThrowIfStep<Pred>{pred, std::move(message)};
+consteval auto checkSourceOf(std::string context) -> CheckSourceStep {
+  return CheckSourceStep{std::move(context)};
 }
 
 consteval auto parseChecked(std::string_view source, std::string message) -> detail::ParseOutput {
@@ -2733,13 +2700,7 @@ consteval auto parseChecked(std::string_view source, std::string message) -> det
   return out;
 }
 
-consteval auto parseAsReflection(std::string_view source) -> meta::info {
-  auto normalized = detail::normalizeSourceView(source);
-  normalized =
-    normalized
-    | throwIf(hasInvalidNewline, std::string{"parseAsReflection: invalid newline"})
-    | throwIf(hasInvalidUtf8, std::string{"parseAsReflection: invalid utf8"});
-  auto out                          = parseChecked(normalized, std::string{"parseAsReflection: parse failed"});
+consteval auto reflectData(detail::ParseOutput const& out) -> meta::info {
   auto values                       = out.values;
   values[0]                         = substitute(^^GeneratedAggregate, out.members);
   auto                    baseValue = substitute(^^constructFrom, values);
@@ -2751,13 +2712,7 @@ consteval auto parseAsReflection(std::string_view source) -> meta::info {
   return substitute(^^constructRoot, rootArgs);
 }
 
-consteval auto parseMetaAsReflection(std::string_view source) -> meta::info {
-  auto normalized = detail::normalizeSourceView(source);
-  normalized =
-    normalized
-    | throwIf(hasInvalidNewline, std::string{"parseMetaAsReflection: invalid newline"})
-    | throwIf(hasInvalidUtf8, std::string{"parseMetaAsReflection: invalid utf8"});
-  auto                    out = parseChecked(normalized, std::string{"parseMetaAsReflection: parse failed"});
+consteval auto reflectMetaEntries(detail::ParseOutput const& out) -> meta::info {
   std::vector<meta::info> entryValues{};
   entryValues.reserve(out.metaEntries.size());
   for (auto const& entry: out.metaEntries) {
@@ -2776,18 +2731,12 @@ consteval auto parseMetaAsReflection(std::string_view source) -> meta::info {
     entryValues.emplace_back(substitute(^^constructMetaEntry, args));
   }
   if (entryValues.empty()) {
-    throw std::string{"parseMetaAsReflection: empty metadata"};
+    throw std::string{"reflectMetaEntries: empty metadata"};
   }
   return substitute(^^constructMetaArray, entryValues);
 }
 
-consteval auto parseCommentsAsReflection(std::string_view source) -> meta::info {
-  auto normalized = detail::normalizeSourceView(source);
-  normalized =
-    normalized
-    | throwIf(hasInvalidNewline, std::string{"parseCommentsAsReflection: invalid newline"})
-    | throwIf(hasInvalidUtf8, std::string{"parseCommentsAsReflection: invalid utf8"});
-  auto out = parseChecked(normalized, std::string{"parseCommentsAsReflection: parse failed"});
+consteval auto reflectComments(detail::ParseOutput const& out) -> meta::info {
   if (out.comments.empty()) {
     return ^^constructEmptyCommentArray;
   }
@@ -2799,6 +2748,43 @@ consteval auto parseCommentsAsReflection(std::string_view source) -> meta::info
   return substitute(^^constructCommentArray, commentValues);
 }
 
+struct DocumentReflection {
+  detail::ParseError error    = detail::ParseError::none;
+  meta::info         data     = ^^void;
+  meta::info         entries  = ^^void;
+  meta::info         comments = ^^void;
+};
+
+consteval auto reflectDocument(std::string_view source, bool withMeta) -> DocumentReflection {
+  auto const out = detail::parseDocument(source);
+  auto       doc = DocumentReflection{};
+  doc.error      = out.error;
+  if (out.error != detail::ParseError::none) {
+    return doc;
+  }
+  doc.data = reflectData(out);
+  if (withMeta) {
+    doc.entries  = reflectMetaEntries(out);
+    doc.comments = reflectComments(out);
+  }
+  return doc;
+}
+
+consteval auto parseAsReflection(std::string_view source) -> meta::info {
+  auto const normalized = detail::normalizeSourceView(source) | checkSourceOf(std::string{"parseAsReflection"});
+  return reflectData(parseChecked(normalized, std::string{"parseAsReflection: parse failed"}));
+}
+
+consteval auto parseMetaAsReflection(std::string_view source) -> meta::info {
+  auto const normalized = detail::normalizeSourceView(source) | checkSourceOf(std::string{"parseMetaAsReflection"});
+  return reflectMetaEntries(parseChecked(normalized, std::string{"parseMetaAsReflection: parse failed"}));
+}
+
+consteval auto parseCommentsAsReflection(std::string_view source) -> meta::info {
+  auto const normalized = detail::normalizeSourceView(source) | checkSourceOf(std::string{"parseCommentsAsReflection"});
+  return reflectComments(parseChecked(normalized, std::string{"parseCommentsAsReflection: parse failed"}));
+}
+
 template<std::size_t EntryCount>
 consteval auto findRootMetaIndex(std::array<MetaEntry, EntryCount> const& entries) -> std::size_t {
   for (std::size_t i = 0; i < entries.size(); ++i) {
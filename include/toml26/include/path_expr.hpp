@@ -0,0 +1,170 @@
+#ifndef TOML26_PATH_EXPR_HPP
+#define TOML26_PATH_EXPR_HPP
+
+namespace path_detail {
+struct PathStep {
+  std::string key{};
+  std::size_t index   = 0;
+  bool        isIndex = false;
+};
+
+constexpr auto isBarePathChar(char c) -> bool {
+  return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_' || c == '-';
+}
+
+// Path syntax: keys joined by `.` (bare, "basic" with \" \\ \b \t \n \f \r escapes, or 'literal'), each optionally
+// followed by `[N]` indices, e.g. `servers."eu west".hosts[2].ip`. The empty path names the root.
+constexpr auto parsePathSpec(std::string_view spec) -> std::vector<PathStep> {
+  auto steps = std::vector<PathStep>{};
+  auto pos   = std::size_t{0};
+  auto error = [&](std::string_view what) -> void {
+    fail("path: " + std::string{what} + " in \"" + std::string{spec} + "\"");
+  };
+  auto needKey = !spec.empty() && spec.front() != '[';
+  while (pos < spec.size() || needKey) {
+    if (needKey) {
+      auto step = PathStep{};
+      if (pos < spec.size() && spec[pos] == '"') {
+        for (++pos; pos < spec.size() && spec[pos] != '"'; ++pos) {
+          if (spec[pos] != '\\') {
+            step.key.push_back(spec[pos]);
+            continue;
+          }
+          if (++pos >= spec.size()) {
+            break;
+          }
+          switch (spec[pos]) {
+          case '"' : step.key.push_back('"'); break;
+          case '\\': step.key.push_back('\\'); break;
+          case 'b' : step.key.push_back('\b'); break;
+          case 't' : step.key.push_back('\t'); break;
+          case 'n' : step.key.push_back('\n'); break;
+          case 'f' : step.key.push_back('\f'); break;
+          case 'r' : step.key.push_back('\r'); break;
+          default  : error("unsupported escape");
+          }
+        }
+        if (pos >= spec.size()) {
+          error("unterminated quoted key");
+        }
+        ++pos;
+      } else if (pos < spec.size() && spec[pos] == '\'') {
+        auto const close = spec.find('\'', pos + 1);
+        if (close == std::string_view::npos) {
+          error("unterminated quoted key");
+        }
+        step.key = std::string{spec.substr(pos + 1, close - pos - 1)};
+        pos      = close + 1;
+      } else {
+        auto const first = pos;
+        while (pos < spec.size() && isBarePathChar(spec[pos])) {
+          ++pos;
+        }
+        if (pos == first) {
+          error("expected a key");
+        }
+        step.key = std::string{spec.substr(first, pos - first)};
+      }
+      steps.push_back(std::move(step));
+      needKey = false;
+    } else if (spec[pos] == '.') {
+      ++pos;
+      needKey = true;
+    } else if (spec[pos] == '[') {
+      auto step    = PathStep{};
+      step.isIndex = true;
+      auto digits  = std::size_t{0};
+      for (++pos; pos < spec.size() && spec[pos] >= '0' && spec[pos] <= '9'; ++pos, ++digits) {
+        step.index = step.index * 10 + static_cast<std::size_t>(spec[pos] - '0');
+      }
+      if (digits == 0 || pos >= spec.size() || spec[pos] != ']') {
+        error("expected [digits]");
+      }
+      ++pos;
+      steps.push_back(std::move(step));
+    } else {
+      error("expected '.' or '['");
+    }
+  }
+  return steps;
+}
+
+struct StaticPathStep {
+  char const* key     = nullptr;
+  std::size_t size    = 0;
+  std::size_t index   = 0;
+  bool        isIndex = false;
+
+  constexpr auto keyView() const -> std::string_view { return std::string_view{key, size}; }
+};
+
+consteval auto internPathSpec(std::string_view spec) -> std::span<StaticPathStep const> {
+  auto out = std::vector<StaticPathStep>{};
+  for (auto const& step: parsePathSpec(spec)) {
+    out.push_back(StaticPathStep{std::define_static_string(step.key), step.key.size(), step.index, step.isIndex});
+  }
+  return std::define_static_array(out);
+}
+
+template<FixedString Spec>
+inline constexpr auto pathSteps = internPathSpec(Spec.view());
+
+template<typename Obj>
+consteval auto keyPosition(std::string_view key) -> std::size_t {
+  constexpr auto& names = Obj::keyNames;
+  for (std::size_t i = 0; i < names.size(); ++i) {
+    if (names[i] == key) {
+      return i;
+    }
+  }
+  return names.size();
+}
+
+template<FixedString Spec, std::size_t I, typename Obj>
+constexpr decltype(auto) resolvePath(Obj const& obj) {
+  if constexpr (I == pathSteps<Spec>.size()) {
+    return obj;
+  } else {
+    using O             = std::remove_cvref_t<Obj>;
+    constexpr auto step = pathSteps<Spec>[I];
+    if constexpr (step.isIndex) {
+      static_assert(requires { typename O::TomlArrayTag; }, "path: index applied to a value that is not an array");
+      return resolvePath<Spec, I + 1>(obj.template get<step.index>());
+    } else {
+      static_assert(
+        !requires { typename O::TomlArrayTag; } && requires { O::keyNames; },
+        "path: key applied to a value that is not a table"
+      );
+      constexpr auto position = keyPosition<O>(step.keyView());
+      static_assert(position < O::keyNames.size(), "path: key not found");
+      return resolvePath<Spec, I + 1>(obj.template get<position>());
+    }
+  }
+}
+
+// A path parsed and resolved entirely at compile time: applying it is the same member access as writing the
+// chain out by hand, and it returns a reference of the member's real type.
+template<FixedString Spec>
+struct PathExpr {
+  static constexpr auto spec = Spec;
+
+  template<typename Root>
+  constexpr decltype(auto) operator()(Root const& root) const {
+    return resolvePath<Spec, 0>(root);
+  }
+};
+
+template<typename T>
+struct IsPathExprType: std::false_type {};
+
+template<FixedString Spec>
+struct IsPathExprType<PathExpr<Spec>>: std::true_type {};
+
+template<typename T>
+inline constexpr bool isPathExprTypeV = IsPathExprType<std::remove_cvref_t<T>>::value;
+}  // namespace path_detail
+
+template<FixedString Spec>
+inline constexpr auto path = path_detail::PathExpr<Spec>{};
+
+#endif
@@ -0,0 +1,139 @@
+#ifndef TOML26_PATH_INDEX_HPP
+#define TOML26_PATH_INDEX_HPP
+
+// Position of a path in a `PathIndex`; only meaningful for the index that produced it.
+enum class PathId : std::uint32_t {};
+
+namespace path_detail {
+struct IndexedPath {
+  std::string path{};
+  ValueRef    value{};
+};
+
+// Canonical spelling of a path in `toml::path` syntax: bare keys stay bare, other keys are "basic" quoted.
+constexpr auto appendPathKey(std::string& out, std::string_view key) -> void {
+  if (!out.empty()) {
+    out.push_back('.');
+  }
+  if (!key.empty() && std::ranges::all_of(key, isBarePathChar)) {
+    out.append(key);
+    return;
+  }
+  out.push_back('"');
+  for (char const c: key) {
+    switch (c) {
+    case '"' : out.append("\\\""); break;
+    case '\\': out.append("\\\\"); break;
+    case '\b': out.append("\\b"); break;
+    case '\t': out.append("\\t"); break;
+    case '\n': out.append("\\n"); break;
+    case '\f': out.append("\\f"); break;
+    case '\r': out.append("\\r"); break;
+    default  : out.push_back(c); break;
+    }
+  }
+  out.push_back('"');
+}
+
+constexpr auto appendPathIndex(std::string& out, std::size_t index) -> void {
+  auto digits = std::array<char, 20>{};
+  auto first  = digits.size();
+  do {
+    digits[--first] = static_cast<char>('0' + (index % 10U));
+    index /= 10U;
+  } while (index > 0);
+  out.push_back('[');
+  out.append(std::string_view{digits.data() + first, digits.size() - first});
+  out.push_back(']');
+}
+
+struct PathCollector {
+  std::vector<IndexedPath>* out    = nullptr;
+  std::string const*        prefix = nullptr;
+};
+
+constexpr auto collectPaths(std::vector<IndexedPath>& out, std::string const& prefix, ValueRef value) -> void;
+
+constexpr auto collectEntry(void* context, std::string_view key, ValueRef const& value) -> void {
+  auto const& collector = *static_cast<PathCollector const*>(context);
+  auto        path      = *collector.prefix;
+  appendPathKey(path, key);
+  collector.out->push_back(IndexedPath{path, value});
+  collectPaths(*collector.out, path, value);
+}
+
+// Pre-order: every table, array, array element and leaf below `value`, each right before its children.
+constexpr auto collectPaths(std::vector<IndexedPath>& out, std::string const& prefix, ValueRef value) -> void {
+  if (value.type == ValueType::table) {
+    auto collector = PathCollector{&out, &prefix};
+    value.forEachKeyValue(value.ptr, &collector, &collectEntry);
+  } else if (value.type == ValueType::array) {
+    auto const count = value.sizeOf(value.ptr);
+    for (std::size_t i = 0; i < count; ++i) {
+      auto path = prefix;
+      appendPathIndex(path, i);
+      auto const element = value.lookupByIndex(value.ptr, i);
+      out.push_back(IndexedPath{path, element});
+      collectPaths(out, path, element);
+    }
+  }
+}
+
+consteval auto collectRootPaths(ValueRef root) -> std::vector<IndexedPath> {
+  auto out = std::vector<IndexedPath>{};
+  collectPaths(out, std::string{}, root);
+  return out;
+}
+}  // namespace path_detail
+
+// Every path of a constant root in document pre-order, with a perfect-hashed lookup from the canonical path
+// string. A string resolves with one hash probe and one comparison; a `PathId` taken once resolves by position.
+template<std::size_t N>
+struct PathIndex {
+  std::array<std::string_view, N> paths{};
+  std::array<ValueRef, N>         values{};
+  hash_detail::KeyIndex<N>        lookup{};
+
+  static constexpr auto size() -> std::size_t { return N; }
+
+  constexpr auto id(std::string_view path) const -> std::optional<PathId> {
+    auto const idx = lookup.find(paths, path);
+    if (idx >= N) {
+      return std::nullopt;
+    }
+    return static_cast<PathId>(idx);
+  }
+
+  template<FixedString Path>
+  consteval auto id() const -> PathId {
+    auto const found = id(Path.view());
+    if (!found.has_value()) {
+      fail("PathIndex: no path " + std::string{Path.view()});
+    }
+    return *found;
+  }
+
+  constexpr auto find(std::string_view path) const -> ValueRef {
+    auto const idx = lookup.find(paths, path);
+    return idx < N ? values[idx] : ValueRef{};
+  }
+
+  constexpr auto operator[](PathId id) const -> ValueRef const& { return values[static_cast<std::size_t>(id)]; }
+
+  constexpr auto path(PathId id) const -> std::string_view { return paths[static_cast<std::size_t>(id)]; }
+};
+
+template<auto const& Root>
+consteval auto make_path_index() {
+  constexpr auto count = path_detail::collectRootPaths(ValueRef::from(Root)).size();
+  auto const     found = path_detail::collectRootPaths(ValueRef::from(Root));
+  auto           index = PathIndex<count>{};
+  for (std::size_t i = 0; i < count; ++i) {
+    index.paths[i]  = std::string_view{std::define_static_string(found[i].path), found[i].path.size()};
+    index.values[i] = found[i].value;
+  }
+  index.lookup = hash_detail::buildKeyIndex(index.paths);
+  return index;
+}
+
+#endif
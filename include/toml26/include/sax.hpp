@@ -0,0 +1,114 @@
+#ifndef TOML26_SAX_HPP
+#define TOML26_SAX_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "document.hpp"
+
+namespace toml {
+using SaxPath = std::span<std::string_view const>;
+
+namespace sax_detail {
+inline constexpr std::size_t keyBufferBytes = 256;
+
+// Forwards grammar events to a user handler. Nothing outlives the statement that produced it: escaped keys are
+// kept in a buffer released at every top-level statement, so memory stays bounded by the longest statement.
+// Duplicate keys and table redefinitions need the whole tree and are therefore not diagnosed here.
+template<typename Handler>
+struct SaxSink {
+  Handler&                              handler;
+  std::array<std::byte, keyBufferBytes> buffer{};
+  std::pmr::monotonic_buffer_resource   keys{buffer.data(), buffer.size()};
+
+  auto keep(std::string_view text) -> std::string_view {
+    auto* chars = static_cast<char*>(keys.allocate(text.size() + 1, alignof(char)));
+    std::ranges::copy(text, chars);
+    chars[text.size()] = '\0';
+    return std::string_view{chars, text.size()};
+  }
+
+  auto statement() -> void { keys.release(); }
+
+  auto table(SaxPath path) -> detail::ParseError {
+    if constexpr (requires { handler.on_table(path); }) {
+      handler.on_table(path);
+    }
+    return detail::ParseError::none;
+  }
+
+  auto arrayTable(SaxPath path) -> detail::ParseError {
+    if constexpr (requires { handler.on_array_table(path); }) {
+      handler.on_array_table(path);
+    }
+    return detail::ParseError::none;
+  }
+
+  auto key(SaxPath path) -> detail::ParseError {
+    if constexpr (requires { handler.on_key(path); }) {
+      handler.on_key(path);
+    }
+    return detail::ParseError::none;
+  }
+
+  auto scalar(runtime_detail::Node const& value) -> void {
+    if constexpr (requires { handler.on_value(ValueRef{}); }) {
+      handler.on_value(runtime_detail::valueRefOf(value));
+    }
+  }
+
+  auto beginArray() -> void {
+    if constexpr (requires { handler.on_array_begin(); }) {
+      handler.on_array_begin();
+    }
+  }
+
+  auto endArray() -> void {
+    if constexpr (requires { handler.on_array_end(); }) {
+      handler.on_array_end();
+    }
+  }
+
+  auto beginInlineTable() -> void {
+    if constexpr (requires { handler.on_inline_table_begin(); }) {
+      handler.on_inline_table_begin();
+    }
+  }
+
+  auto endInlineTable() -> void {
+    if constexpr (requires { handler.on_inline_table_end(); }) {
+      handler.on_inline_table_end();
+    }
+  }
+
+  auto comment(std::string_view text) -> void {
+    if constexpr (requires { handler.on_comment(text); }) {
+      handler.on_comment(text);
+    }
+  }
+};
+
+template<typename Handler>
+auto run(std::string_view source, Handler& handler, std::string_view context, std::size_t firstLine = 1) -> void {
+  auto const check   = runtime_detail::checkInput(source, context);
+  auto       sink    = SaxSink<Handler>{handler};
+  auto       grammar = runtime_detail::Grammar<SaxSink<Handler>>{source, sink};
+  grammar.context     = context;
+  grammar.firstLine   = firstLine;
+  grammar.hasControls = check.controlCharacters;
+  grammar.parseDocument();
+}
+}  // namespace sax_detail
+
+template<typename Handler>
+auto sax_parse(std::string_view source, Handler&& handler) -> void {
+  sax_detail::run(detail::normalizeSourceView(source), handler, "sax_parse");
+}
+}  // namespace toml
+
+#endif
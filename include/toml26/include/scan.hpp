@@ -0,0 +1,476 @@
+#ifndef TOML26_SCAN_HPP
+#define TOML26_SCAN_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define TOML26_SCAN_X86 1
+#else
+#define TOML26_SCAN_X86 0
+#endif
+
+namespace toml {
+namespace scan_detail {
+inline constexpr std::size_t blockBytes = 64;
+
+struct BlockMasks {
+  std::uint64_t structural = 0;
+  std::uint64_t whitespace = 0;
+};
+
+enum class ScanPath : std::uint8_t { scalar, sse42, avx2 };
+
+using ScanKernel = void (*)(char const* data, std::size_t blocks, BlockMasks* out);
+
+struct SourceCheck {
+  bool loneCarriageReturn = false;
+  bool malformedUtf8      = false;
+  bool controlCharacters  = false;
+};
+
+constexpr auto isDisallowedSourceControl(unsigned char c) -> bool {
+  return (c < 0x20U && c != '\t' && c != '\n' && c != '\r') || c == 0x7FU;
+}
+
+constexpr auto utf8SequenceLength(std::string_view s, std::size_t i) -> std::size_t {
+  auto const  lead   = static_cast<unsigned char>(s[i]);
+  std::size_t length = 0;
+  unsigned    low    = 0x80U;
+  unsigned    high   = 0xBFU;
+  if (lead >= 0xC2U && lead <= 0xDFU) {
+    length = 2;
+  } else if (lead >= 0xE0U && lead <= 0xEFU) {
+    length = 3;
+    low    = lead == 0xE0U ? 0xA0U : 0x80U;
+    high   = lead == 0xEDU ? 0x9FU : 0xBFU;
+  } else if (lead >= 0xF0U && lead <= 0xF4U) {
+    length = 4;
+    low    = lead == 0xF0U ? 0x90U : 0x80U;
+    high   = lead == 0xF4U ? 0x8FU : 0xBFU;
+  } else {
+    return 0;
+  }
+  if (i + length > s.size()) {
+    return 0;
+  }
+  for (std::size_t k = 1; k < length; ++k) {
+    auto const c = static_cast<unsigned char>(s[i + k]);
+    if (c < low || c > high) {
+      return 0;
+    }
+    low  = 0x80U;
+    high = 0xBFU;
+  }
+  return length;
+}
+
+constexpr auto checkSourceScalar(std::string_view s) -> SourceCheck {
+  auto        check = SourceCheck{};
+  std::size_t i     = 0;
+  while (i < s.size()) {
+    auto const c = static_cast<unsigned char>(s[i]);
+    if (c >= 0x80U) {
+      auto const length = utf8SequenceLength(s, i);
+      check.malformedUtf8 = check.malformedUtf8 || length == 0;
+      i += length == 0 ? 1 : length;
+      continue;
+    }
+    if (c == '\r' && (i + 1 >= s.size() || s[i + 1] != '\n')) {
+      return SourceCheck{true, false, false};
+    }
+    check.controlCharacters = check.controlCharacters || isDisallowedSourceControl(c);
+    ++i;
+  }
+  return check;
+}
+
+inline constexpr std::uint8_t utf8TooShort     = 1U << 0;
+inline constexpr std::uint8_t utf8TooLong      = 1U << 1;
+inline constexpr std::uint8_t utf8Overlong3    = 1U << 2;
+inline constexpr std::uint8_t utf8TooLarge     = 1U << 3;
+inline constexpr std::uint8_t utf8Surrogate    = 1U << 4;
+inline constexpr std::uint8_t utf8Overlong2    = 1U << 5;
+inline constexpr std::uint8_t utf8TooLarge1000 = 1U << 6;
+inline constexpr std::uint8_t utf8Overlong4    = 1U << 6;
+inline constexpr std::uint8_t utf8TwoConts     = 1U << 7;
+inline constexpr std::uint8_t utf8Carry        = utf8TooShort | utf8TooLong | utf8TwoConts;
+
+inline constexpr auto utf8Byte1High = [] {
+  auto table = std::array<std::uint8_t, 16>{};
+  std::ranges::fill(table.begin(), table.begin() + 8, utf8TooLong);
+  std::ranges::fill(table.begin() + 8, table.begin() + 12, utf8TwoConts);
+  table[12] = utf8TooShort | utf8Overlong2;
+  table[13] = utf8TooShort;
+  table[14] = utf8TooShort | utf8Overlong3 | utf8Surrogate;
+  table[15] = utf8TooShort | utf8TooLarge | utf8TooLarge1000 | utf8Overlong4;
+  return table;
+}();
+
+inline constexpr auto utf8Byte1Low = [] {
+  auto table = std::array<std::uint8_t, 16>{};
+  std::ranges::fill(table, utf8Carry | utf8TooLarge | utf8TooLarge1000);
+  table[0]  = utf8Carry | utf8Overlong3 | utf8Overlong2 | utf8Overlong4;
+  table[1]  = utf8Carry | utf8Overlong2;
+  table[2]  = utf8Carry;
+  table[3]  = utf8Carry;
+  table[4]  = utf8Carry | utf8TooLarge;
+  table[13] = utf8Carry | utf8TooLarge | utf8TooLarge1000 | utf8Surrogate;
+  return table;
+}();
+
+inline constexpr auto utf8Byte2High = [] {
+  auto table = std::array<std::uint8_t, 16>{};
+  std::ranges::fill(table, utf8TooShort);
+  table[8]  = utf8TooLong | utf8Overlong2 | utf8TwoConts | utf8Overlong3 | utf8TooLarge1000 | utf8Overlong4;
+  table[9]  = utf8TooLong | utf8Overlong2 | utf8TwoConts | utf8Overlong3 | utf8TooLarge;
+  table[10] = utf8TooLong | utf8Overlong2 | utf8TwoConts | utf8Surrogate | utf8TooLarge;
+  table[11] = utf8TooLong | utf8Overlong2 | utf8TwoConts | utf8Surrogate | utf8TooLarge;
+  return table;
+}();
+
+inline constexpr std::uint8_t structuralClass = 1;
+inline constexpr std::uint8_t whitespaceClass = 2;
+
+inline constexpr auto byteClasses = [] {
+  auto table = std::array<std::uint8_t, 256>{};
+  for (std::size_t c = 0; c < 0x20; ++c) {
+    table[c] = structuralClass;
+  }
+  table[0x7F] = structuralClass;
+  for (unsigned char const c: std::string_view{"\"'#=[]{},\\"}) {
+    table[c] = structuralClass;
+  }
+  table['\t'] = whitespaceClass;
+  table[' ']  = whitespaceClass;
+  table['\r'] = structuralClass | whitespaceClass;
+  return table;
+}();
+
+inline auto scanScalar(char const* data, std::size_t blocks, BlockMasks* out) -> void {
+  for (std::size_t b = 0; b < blocks; ++b) {
+    auto masks = BlockMasks{};
+    for (std::size_t i = 0; i < blockBytes; ++i) {
+      auto const cls = byteClasses[static_cast<unsigned char>(data[b * blockBytes + i])];
+      masks.structural |= static_cast<std::uint64_t>(cls & structuralClass) << i;
+      masks.whitespace |= static_cast<std::uint64_t>((cls & whitespaceClass) >> 1) << i;
+    }
+    out[b] = masks;
+  }
+}
+
+#if TOML26_SCAN_X86
+__attribute__((target("sse4.2"))) inline auto scanSse42(char const* data, std::size_t blocks, BlockMasks* out)
+  -> void {
+  constexpr int anyMode   = _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_BIT_MASK;
+  constexpr int rangeMode = _SIDD_UBYTE_OPS | _SIDD_CMP_RANGES | _SIDD_BIT_MASK;
+  auto const    punct     = _mm_setr_epi8('"', '\'', '#', '=', '[', ']', '{', '}', ',', '\\', 0, 0, 0, 0, 0, 0);
+  auto const    controls  = _mm_setr_epi8(0x00, 0x08, 0x0A, 0x1F, 0x7F, 0x7F, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+  auto const    spaces    = _mm_setr_epi8(' ', '\t', '\r', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+  for (std::size_t b = 0; b < blocks; ++b) {
+    auto masks = BlockMasks{};
+    for (std::size_t lane = 0; lane < 4; ++lane) {
+      auto const chunk = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data + b * blockBytes + lane * 16));
+      auto const hits  = _mm_or_si128(_mm_cmpestrm(punct, 10, chunk, 16, anyMode),
+                                      _mm_cmpestrm(controls, 6, chunk, 16, rangeMode));
+      auto const ws    = _mm_cmpestrm(spaces, 3, chunk, 16, anyMode);
+      masks.structural |= std::uint64_t{static_cast<std::uint16_t>(_mm_cvtsi128_si32(hits))} << (lane * 16);
+      masks.whitespace |= std::uint64_t{static_cast<std::uint16_t>(_mm_cvtsi128_si32(ws))} << (lane * 16);
+    }
+    out[b] = masks;
+  }
+}
+
+__attribute__((target("avx2"))) inline auto equalAny(__m256i chunk, char a, char b) -> __m256i {
+  return _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(a)), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(b)));
+}
+
+__attribute__((target("avx2"))) inline auto scanAvx2(char const* data, std::size_t blocks, BlockMasks* out) -> void {
+  for (std::size_t b = 0; b < blocks; ++b) {
+    auto masks = BlockMasks{};
+    for (std::size_t half = 0; half < 2; ++half) {
+      auto const chunk    = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data + b * blockBytes + half * 32));
+      auto const tabs     = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\t'));
+      auto const low      = _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, _mm256_set1_epi8(0x1F)), chunk);
+      auto const del      = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(0x7F));
+      auto const controls = _mm256_or_si256(_mm256_andnot_si256(tabs, low), del);
+      auto const quotes   = _mm256_or_si256(equalAny(chunk, '"', '\''), equalAny(chunk, '\\', '#'));
+      auto const markers  = _mm256_or_si256(equalAny(chunk, '=', ','), equalAny(chunk, '[', ']'));
+      auto const hits     = _mm256_or_si256(_mm256_or_si256(controls, quotes),
+                                            _mm256_or_si256(markers, equalAny(chunk, '{', '}')));
+      auto const ws       = _mm256_or_si256(equalAny(chunk, ' ', '\r'), tabs);
+      masks.structural |= std::uint64_t{static_cast<std::uint32_t>(_mm256_movemask_epi8(hits))} << (half * 32);
+      masks.whitespace |= std::uint64_t{static_cast<std::uint32_t>(_mm256_movemask_epi8(ws))} << (half * 32);
+    }
+    out[b] = masks;
+  }
+}
+
+__attribute__((target("sse4.2"))) inline auto loadTable(std::array<std::uint8_t, 16> const& table) -> __m128i {
+  return _mm_loadu_si128(reinterpret_cast<__m128i const*>(table.data()));
+}
+
+__attribute__((target("sse4.2"))) inline auto utf8ErrorsSse42(__m128i input, __m128i previous) -> __m128i {
+  auto const nibble  = _mm_set1_epi8(0x0F);
+  auto const prev1   = _mm_alignr_epi8(input, previous, 15);
+  auto const high1   = _mm_shuffle_epi8(loadTable(utf8Byte1High), _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+  auto const low1    = _mm_shuffle_epi8(loadTable(utf8Byte1Low), _mm_and_si128(prev1, nibble));
+  auto const high2   = _mm_shuffle_epi8(loadTable(utf8Byte2High), _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+  auto const special = _mm_and_si128(_mm_and_si128(high1, low1), high2);
+  auto const third   = _mm_subs_epu8(_mm_alignr_epi8(input, previous, 14), _mm_set1_epi8(0x60));
+  auto const fourth  = _mm_subs_epu8(_mm_alignr_epi8(input, previous, 13), _mm_set1_epi8(0x70));
+  auto const must23  = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8(static_cast<char>(0x80)));
+  return _mm_xor_si128(must23, special);
+}
+
+__attribute__((target("sse4.2"))) inline auto checkSourceSse42(std::string_view s) -> SourceCheck {
+  auto const incompleteMax = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, static_cast<char>(0xEF),
+                                           static_cast<char>(0xDF), static_cast<char>(0xBF));
+  auto       errors        = _mm_setzero_si128();
+  auto       controls      = _mm_setzero_si128();
+  auto       previous      = _mm_setzero_si128();
+  auto       incomplete    = _mm_setzero_si128();
+  auto       tail          = std::array<char, blockBytes>{};
+  bool       pendingCr     = false;
+  for (std::size_t offset = 0; offset < s.size(); offset += blockBytes) {
+    auto const* data = s.data() + offset;
+    if (s.size() - offset < blockBytes) {
+      std::ranges::fill(tail, ' ');
+      std::ranges::copy(s.substr(offset), tail.begin());
+      data = tail.data();
+    }
+    std::uint64_t crBits = 0;
+    std::uint64_t lfBits = 0;
+    for (std::size_t lane = 0; lane < 4; ++lane) {
+      auto const chunk = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data + lane * 16));
+      auto const cr    = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r'));
+      auto const lf    = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'));
+      auto const tab   = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'));
+      auto const low   = _mm_cmpeq_epi8(_mm_min_epu8(chunk, _mm_set1_epi8(0x1F)), chunk);
+      auto const del   = _mm_cmpeq_epi8(chunk, _mm_set1_epi8(0x7F));
+      auto const other = _mm_andnot_si128(_mm_or_si128(_mm_or_si128(cr, lf), tab), low);
+      crBits |= std::uint64_t{static_cast<std::uint16_t>(_mm_movemask_epi8(cr))} << (lane * 16);
+      lfBits |= std::uint64_t{static_cast<std::uint16_t>(_mm_movemask_epi8(lf))} << (lane * 16);
+      controls = _mm_or_si128(controls, _mm_or_si128(other, del));
+      if (_mm_movemask_epi8(chunk) == 0) {
+        errors = _mm_or_si128(errors, incomplete);
+      } else {
+        errors     = _mm_or_si128(errors, utf8ErrorsSse42(chunk, previous));
+        incomplete = _mm_subs_epu8(chunk, incompleteMax);
+      }
+      previous = chunk;
+    }
+    if ((pendingCr && (lfBits & 1U) == 0) || (crBits & ~(lfBits >> 1) & ~(std::uint64_t{1} << 63)) != 0) {
+      return SourceCheck{true, false, false};
+    }
+    pendingCr = (crBits >> 63) != 0;
+  }
+  errors = _mm_or_si128(errors, incomplete);
+  if (pendingCr) {
+    return SourceCheck{true, false, false};
+  }
+  return SourceCheck{false, _mm_testz_si128(errors, errors) == 0, _mm_testz_si128(controls, controls) == 0};
+}
+
+__attribute__((target("avx2"))) inline auto loadTableAvx2(std::array<std::uint8_t, 16> const& table) -> __m256i {
+  return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const*>(table.data())));
+}
+
+template<int N>
+__attribute__((target("avx2"))) inline auto previousBytesAvx2(__m256i input, __m256i previous) -> __m256i {
+  return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(previous, input, 0x21), 16 - N);
+}
+
+__attribute__((target("avx2"))) inline auto utf8ErrorsAvx2(__m256i input, __m256i previous) -> __m256i {
+  auto const nibble  = _mm256_set1_epi8(0x0F);
+  auto const prev1   = previousBytesAvx2<1>(input, previous);
+  auto const prevHi  = _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble);
+  auto const inputHi = _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble);
+  auto const high1   = _mm256_shuffle_epi8(loadTableAvx2(utf8Byte1High), prevHi);
+  auto const low1    = _mm256_shuffle_epi8(loadTableAvx2(utf8Byte1Low), _mm256_and_si256(prev1, nibble));
+  auto const high2   = _mm256_shuffle_epi8(loadTableAvx2(utf8Byte2High), inputHi);
+  auto const special = _mm256_and_si256(_mm256_and_si256(high1, low1), high2);
+  auto const third   = _mm256_subs_epu8(previousBytesAvx2<2>(input, previous), _mm256_set1_epi8(0x60));
+  auto const fourth  = _mm256_subs_epu8(previousBytesAvx2<3>(input, previous), _mm256_set1_epi8(0x70));
+  auto const must23  = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+  return _mm256_xor_si256(must23, special);
+}
+
+__attribute__((target("avx2"))) inline auto checkSourceAvx2(std::string_view s) -> SourceCheck {
+  auto incompleteMax = _mm256_set1_epi8(-1);
+  incompleteMax      = _mm256_insert_epi8(incompleteMax, static_cast<char>(0xEF), 29);
+  incompleteMax      = _mm256_insert_epi8(incompleteMax, static_cast<char>(0xDF), 30);
+  incompleteMax      = _mm256_insert_epi8(incompleteMax, static_cast<char>(0xBF), 31);
+  auto errors        = _mm256_setzero_si256();
+  auto controls      = _mm256_setzero_si256();
+  auto previous      = _mm256_setzero_si256();
+  auto incomplete    = _mm256_setzero_si256();
+  auto tail          = std::array<char, blockBytes>{};
+  bool pendingCr     = false;
+  for (std::size_t offset = 0; offset < s.size(); offset += blockBytes) {
+    auto const* data = s.data() + offset;
+    if (s.size() - offset < blockBytes) {
+      std::ranges::fill(tail, ' ');
+      std::ranges::copy(s.substr(offset), tail.begin());
+      data = tail.data();
+    }
+    std::uint64_t crBits = 0;
+    std::uint64_t lfBits = 0;
+    for (std::size_t half = 0; half < 2; ++half) {
+      auto const chunk = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data + half * 32));
+      auto const cr    = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\r'));
+      auto const lf    = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n'));
+      auto const tab   = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\t'));
+      auto const low   = _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, _mm256_set1_epi8(0x1F)), chunk);
+      auto const del   = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(0x7F));
+      auto const other = _mm256_andnot_si256(_mm256_or_si256(_mm256_or_si256(cr, lf), tab), low);
+      crBits |= std::uint64_t{static_cast<std::uint32_t>(_mm256_movemask_epi8(cr))} << (half * 32);
+      lfBits |= std::uint64_t{static_cast<std::uint32_t>(_mm256_movemask_epi8(lf))} << (half * 32);
+      controls = _mm256_or_si256(controls, _mm256_or_si256(other, del));
+      if (_mm256_movemask_epi8(chunk) == 0) {
+        errors = _mm256_or_si256(errors, incomplete);
+      } else {
+        errors     = _mm256_or_si256(errors, utf8ErrorsAvx2(chunk, previous));
+        incomplete = _mm256_subs_epu8(chunk, incompleteMax);
+      }
+      previous = chunk;
+    }
+    if ((pendingCr && (lfBits & 1U) == 0) || (crBits & ~(lfBits >> 1) & ~(std::uint64_t{1} << 63)) != 0) {
+      return SourceCheck{true, false, false};
+    }
+    pendingCr = (crBits >> 63) != 0;
+  }
+  errors = _mm256_or_si256(errors, incomplete);
+  if (pendingCr) {
+    return SourceCheck{true, false, false};
+  }
+  return SourceCheck{false, _mm256_testz_si256(errors, errors) == 0, _mm256_testz_si256(controls, controls) == 0};
+}
+#endif
+
+inline auto isScanPathSupported(ScanPath path) -> bool {
+  switch (path) {
+  case ScanPath::scalar: return true;
+#if TOML26_SCAN_X86
+  case ScanPath::sse42: return __builtin_cpu_supports("sse4.2") != 0;
+  case ScanPath::avx2 : return __builtin_cpu_supports("avx2") != 0;
+#endif
+  default: return false;
+  }
+}
+
+inline auto bestScanPath() -> ScanPath {
+  static auto const path = [] {
+    for (auto const candidate: {ScanPath::avx2, ScanPath::sse42}) {
+      if (isScanPathSupported(candidate)) {
+        return candidate;
+      }
+    }
+    return ScanPath::scalar;
+  }();
+  return path;
+}
+
+inline auto scanKernel(ScanPath path) -> ScanKernel {
+  switch (path) {
+#if TOML26_SCAN_X86
+  case ScanPath::sse42: return &scanSse42;
+  case ScanPath::avx2 : return &scanAvx2;
+#endif
+  default: return &scanScalar;
+  }
+}
+
+using SourceChecker = auto (*)(std::string_view s) -> SourceCheck;
+
+inline auto sourceChecker(ScanPath path) -> SourceChecker {
+  switch (path) {
+#if TOML26_SCAN_X86
+  case ScanPath::sse42: return &checkSourceSse42;
+  case ScanPath::avx2 : return &checkSourceAvx2;
+#endif
+  default: return &checkSourceScalar;
+  }
+}
+
+constexpr auto checkSource(std::string_view s) -> SourceCheck {
+  if consteval {
+    return checkSourceScalar(s);
+  } else {
+    return sourceChecker(bestScanPath())(s);
+  }
+}
+
+inline auto scanPathName(ScanPath path) -> std::string_view {
+  switch (path) {
+  case ScanPath::sse42: return "sse4.2";
+  case ScanPath::avx2 : return "avx2";
+  default             : return "scalar";
+  }
+}
+
+struct StructuralIndex {
+  static constexpr std::size_t windowBlocks = 256;
+
+  std::string_view                     src{};
+  ScanKernel                           kernel     = scanKernel(bestScanPath());
+  std::size_t                          firstBlock = 0;
+  std::size_t                          blockCount = 0;
+  std::array<BlockMasks, windowBlocks> masks{};
+
+  auto load(std::size_t block) -> void {
+    auto const completeBlocks = src.size() / blockBytes;
+    auto const totalBlocks    = (src.size() + blockBytes - 1) / blockBytes;
+    firstBlock                = block;
+    blockCount                = std::min(windowBlocks, totalBlocks - block);
+    auto const fullBlocks     = block < completeBlocks ? std::min(blockCount, completeBlocks - block) : 0;
+    kernel(src.data() + block * blockBytes, fullBlocks, masks.data());
+    if (fullBlocks < blockCount) {
+      auto tail = std::array<char, blockBytes>{};
+      std::ranges::fill(tail, ' ');
+      std::ranges::copy(src.substr((block + fullBlocks) * blockBytes), tail.begin());
+      kernel(tail.data(), 1, masks.data() + fullBlocks);
+    }
+  }
+
+  auto at(std::size_t block) -> BlockMasks const& {
+    if (block < firstBlock || block >= firstBlock + blockCount) {
+      load(block);
+    }
+    return masks[block - firstBlock];
+  }
+
+  template<typename Select>
+  auto find(std::size_t from, Select select) -> std::size_t {
+    while (from < src.size()) {
+      auto const block = from / blockBytes;
+      auto const bits  = select(at(block)) & (~std::uint64_t{0} << (from % blockBytes));
+      if (bits != 0) {
+        return std::min(block * blockBytes + static_cast<std::size_t>(std::countr_zero(bits)), src.size());
+      }
+      from = (block + 1) * blockBytes;
+    }
+    return src.size();
+  }
+
+  auto nextStructural(std::size_t from) -> std::size_t {
+    return find(from, [](BlockMasks const& m) { return m.structural; });
+  }
+
+  auto nextDelimiter(std::size_t from) -> std::size_t {
+    return find(from, [](BlockMasks const& m) { return m.structural | m.whitespace; });
+  }
+
+  auto skipWhitespace(std::size_t from) -> std::size_t {
+    return find(from, [](BlockMasks const& m) { return ~m.whitespace; });
+  }
+};
+}  // namespace scan_detail
+}  // namespace toml
+
+#endif
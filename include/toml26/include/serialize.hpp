@@ -0,0 +1,55 @@
+#ifndef TOML26_SERIALIZE_HPP
+#define TOML26_SERIALIZE_HPP
+
+#include <span>
+#include <string>
+
+#include "toml_emit.hpp"
+
+namespace toml {
+namespace toml_detail {
+template<TomlSink Out, typename Root>
+constexpr auto emitDocument(Out& out, Root const& root) -> void {
+  auto emitter = Emitter<Out>{out};
+  emitter.document(ValueRef::from(root));
+}
+
+template<TomlSink Out, typename Data, typename Meta>
+constexpr auto emitDocument(Out& out, ParseWithMetaOutput<Data, Meta> const& parsed) -> void {
+  auto emitter = Emitter<Out>{
+    out,
+    std::span<MetaEntry const>{parsed.meta.entries},
+    std::span<char const* const>{parsed.meta.comments},
+  };
+  emitter.document(ValueRef::from(parsed.data));
+}
+}  // namespace toml_detail
+
+// `Root` is any table `ValueRef::from` accepts (compile-time roots, runtime documents, `ValueRef`), or the result of
+// `parse_with_meta`, whose entries and comment pools restore inline tables, dotted keys, implicit super-tables and
+// comments. Values themselves are written canonically: basic strings, shortest round-trip floats.
+template<typename Root>
+constexpr auto toml_size(Root const& root) -> std::size_t {
+  auto counter = json_detail::SizeCounter{};
+  toml_detail::emitDocument(counter, root);
+  return counter.size;
+}
+
+template<typename Root, toml_detail::TomlSink Out>
+constexpr auto to_toml(Root const& root, Out& out) -> void {
+  toml_detail::emitDocument(out, root);
+  if constexpr (requires { out.flush(); }) {
+    out.flush();
+  }
+}
+
+template<typename Root>
+constexpr auto to_toml(Root const& root) -> std::string {
+  auto out = std::string{};
+  out.reserve(toml_size(root));
+  toml_detail::emitDocument(out, root);
+  return out;
+}
+}  // namespace toml
+
+#endif
@@ -0,0 +1,204 @@
+#ifndef TOML26_STREAM_HPP
+#define TOML26_STREAM_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "sax.hpp"
+
+namespace toml {
+namespace stream_detail {
+inline constexpr std::size_t fileChunkBytes = 64 * 1024;
+
+enum class Lexeme : std::uint8_t {
+  code,
+  comment,
+  basic,
+  literal,
+  multilineBasic,
+  multilineLiteral,
+};
+
+// Finds where top-level statements end in a growing buffer: a newline outside strings, comments, arrays and inline
+// tables. It only tracks enough lexical state to resume at any byte; the grammar still validates every statement.
+struct StatementScanner {
+  Lexeme      lexeme = Lexeme::code;
+  std::size_t depth  = 0;
+  std::size_t next   = 0;
+  std::size_t end    = 0;
+
+  auto scan(std::string_view text) -> void {
+    while (next < text.size()) {
+      auto const c     = text[next];
+      auto const ahead = text.size() - next - 1;
+      switch (lexeme) {
+      case Lexeme::code:
+        if (c == '"' || c == '\'') {
+          if (ahead < 2) {
+            return;
+          }
+          bool const triple = text[next + 1] == c && text[next + 2] == c;
+          if (c == '"') {
+            lexeme = triple ? Lexeme::multilineBasic : Lexeme::basic;
+          } else {
+            lexeme = triple ? Lexeme::multilineLiteral : Lexeme::literal;
+          }
+          next += triple ? 3 : 1;
+          continue;
+        }
+        if (c == '#') {
+          lexeme = Lexeme::comment;
+        } else if (c == '[' || c == '{') {
+          ++depth;
+        } else if ((c == ']' || c == '}') && depth > 0) {
+          --depth;
+        } else if (c == '\n' && depth == 0) {
+          end = next + 1;
+        }
+        ++next;
+        continue;
+      case Lexeme::comment:
+      case Lexeme::literal:
+        if (c == '\n') {
+          lexeme = Lexeme::code;
+          continue;
+        }
+        if (c == '\'' && lexeme == Lexeme::literal) {
+          lexeme = Lexeme::code;
+        }
+        ++next;
+        continue;
+      case Lexeme::basic:
+        if (c == '\n') {
+          lexeme = Lexeme::code;
+          continue;
+        }
+        if (c == '\\') {
+          if (ahead < 1) {
+            return;
+          }
+          next += 2;
+          continue;
+        }
+        if (c == '"') {
+          lexeme = Lexeme::code;
+        }
+        ++next;
+        continue;
+      case Lexeme::multilineBasic:
+      case Lexeme::multilineLiteral: {
+        auto const quote = lexeme == Lexeme::multilineBasic ? '"' : '\'';
+        if (c == '\\' && quote == '"') {
+          if (ahead < 1) {
+            return;
+          }
+          next += 2;
+          continue;
+        }
+        if (c == quote) {
+          // Up to two quotes may sit right before the closing delimiter, so the whole run is taken at once; a run
+          // that reaches the end of the buffer may still grow.
+          auto run = std::size_t{1};
+          while (next + run < text.size() && text[next + run] == quote) {
+            ++run;
+          }
+          if (next + run == text.size()) {
+            return;
+          }
+          if (run >= 3) {
+            lexeme = Lexeme::code;
+          }
+          next += run;
+          continue;
+        }
+        ++next;
+        continue;
+      }
+      }
+    }
+  }
+};
+}  // namespace stream_detail
+
+// Push parser over arbitrarily split input. Complete statements are parsed as soon as their terminating newline
+// arrives, so only the unfinished statement is buffered between feeds.
+template<typename Handler>
+struct StreamParser {
+  Handler                         handler;
+  std::string                     pending{};
+  stream_detail::StatementScanner scanner{};
+  std::size_t                     line     = 1;
+  bool                            finished = false;
+  std::string_view                context  = "stream_parse";
+
+  auto feed(std::span<char const> chunk) -> void {
+    if (finished) {
+      fail(std::string{context} + ": feed after finish");
+    }
+    pending.append(chunk.data(), chunk.size());
+    scanner.scan(pending);
+    if (scanner.end == 0) {
+      return;
+    }
+    consume(std::string_view{pending}.substr(0, scanner.end));
+    pending.erase(0, scanner.end);
+    scanner.next -= scanner.end;
+    scanner.end = 0;
+  }
+
+  auto finish() -> void {
+    if (finished) {
+      fail(std::string{context} + ": finish called twice");
+    }
+    finished = true;
+    consume(detail::normalizeSourceView(pending));
+    pending.clear();
+  }
+
+  auto consume(std::string_view statements) -> void {
+    sax_detail::run(statements, handler, context, line);
+    line += static_cast<std::size_t>(std::ranges::count(statements, '\n'));
+  }
+};
+
+template<typename Handler>
+StreamParser(Handler&&) -> StreamParser<Handler>;
+
+// Without mmap the file is read in fixed-size chunks through a StreamParser, so memory stays bounded by the chunk
+// and the longest statement rather than the file.
+template<typename Handler>
+auto sax_parse_file(std::filesystem::path const& path, Handler&& handler) -> void {
+#if TOML26_HAS_MMAP
+  auto const mapping = runtime_detail::mapFile(path, "sax_parse_file");
+  if (mapping->address != nullptr) {
+    ::madvise(mapping->address, mapping->length, MADV_SEQUENTIAL);
+  }
+  sax_detail::run(mapping->bytes(), handler, "sax_parse_file");
+#else
+  auto file = std::ifstream{path, std::ios::binary};
+  if (!file) {
+    fail("sax_parse_file: cannot open " + path.string());
+  }
+  auto parser    = StreamParser<std::remove_reference_t<Handler>&>{handler};
+  parser.context = "sax_parse_file";
+  auto chunk     = std::string(stream_detail::fileChunkBytes, '\0');
+  while (file) {
+    file.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    parser.feed(std::span<char const>{chunk.data(), static_cast<std::size_t>(file.gcount())});
+  }
+  if (file.bad()) {
+    fail("sax_parse_file: cannot read " + path.string());
+  }
+  parser.finish();
+#endif
+}
+}  // namespace toml
+
+#endif
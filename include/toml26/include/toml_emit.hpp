@@ -0,0 +1,466 @@
+#ifndef TOML26_TOML_EMIT_HPP
+#define TOML26_TOML_EMIT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "json_emit.hpp"
+
+namespace toml::toml_detail {
+template<typename Out>
+concept TomlSink = json_detail::JsonSink<Out>;
+
+inline constexpr auto noEntry = static_cast<std::size_t>(-1);
+
+// One step from the root to the node being written. Frames live on the emitter's call stack, so nodes are matched
+// against `MetaEntry::path` and headers are spelled without building a path string.
+struct PathFrame {
+  PathFrame const* parent  = nullptr;
+  std::string_view key     = {};
+  std::size_t      index   = 0;
+  bool             element = false;
+};
+
+// Returns the length of the prefix of `path` spelled by `frame`, or `noEntry` when it does not match.
+constexpr auto matchPath(std::string_view path, PathFrame const* frame) -> std::size_t {
+  if (frame == nullptr) {
+    return 0;
+  }
+  auto pos = matchPath(path, frame->parent);
+  if (pos == noEntry) {
+    return noEntry;
+  }
+  if (frame->element) {
+    auto digits = std::array<char, 20>{};
+    auto first  = digits.size();
+    auto rem    = frame->index;
+    do {
+      digits[--first] = static_cast<char>('0' + (rem % 10U));
+      rem /= 10U;
+    } while (rem > 0);
+    auto const text = std::string_view{digits.data() + first, digits.size() - first};
+    if (path.substr(pos, 1) != "[" || path.substr(pos + 1, text.size()) != text
+        || path.substr(pos + 1 + text.size(), 1) != "]") {
+      return noEntry;
+    }
+    return pos + text.size() + 2;
+  }
+  if (frame->parent != nullptr) {
+    if (path.substr(pos, 1) != ".") {
+      return noEntry;
+    }
+    ++pos;
+  }
+  if (path.substr(pos, frame->key.size()) != frame->key) {
+    return noEntry;
+  }
+  return pos + frame->key.size();
+}
+
+constexpr auto isBareKey(std::string_view key) -> bool {
+  if (key.empty()) {
+    return false;
+  }
+  for (char const c: key) {
+    auto const alnum = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9');
+    if (!alnum && c != '_' && c != '-') {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<TomlSink Out>
+constexpr auto appendBasicString(Out& out, std::string_view value) -> void {
+  constexpr auto hex = std::string_view{"0123456789ABCDEF"};
+  out.push_back('"');
+  std::size_t run = 0;
+  for (std::size_t i = 0; i < value.size(); ++i) {
+    auto const c = static_cast<unsigned char>(value[i]);
+    if (c >= 0x20U && c != '"' && c != '\\' && c != 0x7FU) {
+      continue;
+    }
+    out.append(value.substr(run, i - run));
+    run = i + 1;
+    switch (c) {
+    case '\"': out.append("\\\""); break;
+    case '\\': out.append("\\\\"); break;
+    case '\b': out.append("\\b"); break;
+    case '\f': out.append("\\f"); break;
+    case '\n': out.append("\\n"); break;
+    case '\r': out.append("\\r"); break;
+    case '\t': out.append("\\t"); break;
+    default:
+      out.append("\\u00");
+      out.push_back(hex[(c >> 4) & 0x0F]);
+      out.push_back(hex[c & 0x0F]);
+      break;
+    }
+  }
+  out.append(value.substr(run));
+  out.push_back('"');
+}
+
+template<TomlSink Out>
+constexpr auto appendKey(Out& out, std::string_view key) -> void {
+  if (isBareKey(key)) {
+    out.append(key);
+  } else {
+    appendBasicString(out, key);
+  }
+}
+
+// Shortest round-trip digits as for JSON, plus the spellings TOML needs: `inf` / `nan`, and a `.0` suffix so an
+// integral value still reads back as a float.
+template<TomlSink Out>
+constexpr auto appendFloat(Out& out, double value) -> void {
+  constexpr auto max = std::numeric_limits<double>::max();
+  if (value != value) {
+    out.append("nan");
+    return;
+  }
+  if (value > max || value < -max) {
+    out.append(value < 0 ? "-inf" : "inf");
+    return;
+  }
+  auto       text = std::array<char, 32>{};
+  auto const size = float_detail::formatShortest(value, text);
+  auto const view = std::string_view{text.data(), size};
+  out.append(view);
+  if (view.find_first_of(".e") == std::string_view::npos) {
+    out.append(".0");
+  }
+}
+
+constexpr auto isTableArray(ValueRef value) -> bool {
+  auto const count = value.sizeOf(value.ptr);
+  for (std::size_t i = 0; i < count; ++i) {
+    if (value.lookupByIndex(value.ptr, i).type != ValueType::table) {
+      return false;
+    }
+  }
+  return count > 0;
+}
+
+enum class Layout : std::uint8_t {
+  inlineValue,
+  dotted,
+  section,
+  arrayOfTables,
+};
+
+// Without a meta entry the layout follows the usual conventions: tables get headers and non-empty arrays of
+// tables become `[[...]]`. A meta entry reproduces what the source used instead.
+constexpr auto layoutOf(ValueRef value, MetaEntry const* entry) -> Layout {
+  if (value.type == ValueType::table) {
+    if (entry == nullptr) {
+      return Layout::section;
+    }
+    if (entry->inlineTable) {
+      return Layout::inlineValue;
+    }
+    return entry->dottedDefined ? Layout::dotted : Layout::section;
+  }
+  if (value.type == ValueType::array) {
+    auto const tables = (entry != nullptr) ? entry->arrayContainer : isTableArray(value);
+    return tables ? Layout::arrayOfTables : Layout::inlineValue;
+  }
+  return Layout::inlineValue;
+}
+
+template<TomlSink Out>
+struct Emitter;
+
+template<TomlSink Out>
+struct TableContext {
+  Emitter<Out>*    emitter = nullptr;
+  PathFrame const* parent  = nullptr;
+  PathFrame const* section = nullptr;
+  std::size_t      hint    = 0;
+  std::size_t      count   = 0;
+};
+
+template<TomlSink Out>
+struct InlineContext {
+  Emitter<Out>* emitter = nullptr;
+  bool          first   = true;
+};
+
+// Writes a document in two passes per table: key/value lines (including inline tables, inline arrays and dotted
+// sub-tables) first, then `[table]` and `[[array]]` sections, which is the only order TOML can read back. Meta
+// entries appear in the same pre-order, so each lookup resumes after the previous sibling instead of rescanning.
+// A table header is held back until the first line under it, and dropped for implicit super-tables.
+template<TomlSink Out>
+struct Emitter {
+  Out&                         out;
+  std::span<MetaEntry const>   entries{};
+  std::span<char const* const> comments{};
+  PathFrame const*             pendingFrame = nullptr;
+  MetaEntry const*             pendingEntry = nullptr;
+  bool                         started      = false;
+
+  constexpr auto find(PathFrame const& frame, std::size_t& hint) const -> std::size_t {
+    auto const matches = [&](std::size_t i) {
+      auto const path = std::string_view{entries[i].path};
+      return matchPath(path, &frame) == path.size();
+    };
+    for (auto i = hint; i < entries.size(); ++i) {
+      if (matches(i)) {
+        hint = i + 1;
+        return i;
+      }
+    }
+    for (std::size_t i = 0; i < hint && i < entries.size(); ++i) {
+      if (matches(i)) {
+        hint = i + 1;
+        return i;
+      }
+    }
+    return noEntry;
+  }
+
+  constexpr auto entryAt(std::size_t index) const -> MetaEntry const* {
+    return index == noEntry ? nullptr : &entries[index];
+  }
+
+  constexpr auto leading(MetaEntry const* entry) -> void {
+    if (entry == nullptr) {
+      return;
+    }
+    for (std::size_t i = 0; i < entry->leadingCount; ++i) {
+      out.push_back('#');
+      out.append(std::string_view{comments[entry->leadingOffset + i]});
+      out.push_back('\n');
+    }
+  }
+
+  // Ends the current line; the first trailing comment stays on it, any others follow on their own lines.
+  constexpr auto trailing(MetaEntry const* entry) -> void {
+    if (entry != nullptr) {
+      for (std::size_t i = 0; i < entry->trailingCount; ++i) {
+        out.append(i == 0 ? " #" : "\n#");
+        out.append(std::string_view{comments[entry->trailingOffset + i]});
+      }
+    }
+    out.push_back('\n');
+  }
+
+  constexpr auto headerPath(PathFrame const* frame) -> bool {
+    if (frame == nullptr) {
+      return false;
+    }
+    if (frame->element) {
+      return headerPath(frame->parent);
+    }
+    if (headerPath(frame->parent)) {
+      out.push_back('.');
+    }
+    appendKey(out, frame->key);
+    return true;
+  }
+
+  constexpr auto dottedKey(PathFrame const* frame, PathFrame const* section) -> void {
+    if (frame->parent != section) {
+      dottedKey(frame->parent, section);
+      out.push_back('.');
+    }
+    appendKey(out, frame->key);
+  }
+
+  constexpr auto header(PathFrame const* frame, MetaEntry const* entry, bool array) -> void {
+    if (started) {
+      out.push_back('\n');
+    }
+    leading(entry);
+    out.append(array ? "[[" : "[");
+    headerPath(frame);
+    out.append(array ? "]]" : "]");
+    trailing(entry);
+    started = true;
+  }
+
+  constexpr auto flushHeader() -> void {
+    if (pendingFrame != nullptr) {
+      auto const* frame = pendingFrame;
+      pendingFrame      = nullptr;
+      header(frame, pendingEntry, false);
+    }
+  }
+
+  constexpr auto keyLine(PathFrame const& frame, PathFrame const* section, ValueRef value, MetaEntry const* entry)
+    -> void {
+    flushHeader();
+    leading(entry);
+    dottedKey(&frame, section);
+    out.append(" = ");
+    inlineValue(value);
+    trailing(entry);
+    started = true;
+  }
+
+  static constexpr auto keyEntry(void* context, std::string_view key, ValueRef const& value) -> void {
+    auto&      ctx   = *static_cast<TableContext<Out>*>(context);
+    auto&      self  = *ctx.emitter;
+    auto const frame = PathFrame{ctx.parent, key, 0, false};
+    auto const index = self.find(frame, ctx.hint);
+    auto const entry = self.entryAt(index);
+    ++ctx.count;
+    switch (layoutOf(value, entry)) {
+    case Layout::inlineValue: self.keyLine(frame, ctx.section, value, entry); break;
+    case Layout::dotted     : self.keys(value, frame, ctx.section, index == noEntry ? ctx.hint : index + 1); break;
+    default                 : break;
+    }
+  }
+
+  constexpr auto keys(ValueRef table, PathFrame const& frame, PathFrame const* section, std::size_t hint)
+    -> std::size_t {
+    auto ctx = TableContext<Out>{this, &frame, section, hint, 0};
+    table.forEachKeyValue(table.ptr, &ctx, &keyEntry);
+    return ctx.count;
+  }
+
+  static constexpr auto sectionEntry(void* context, std::string_view key, ValueRef const& value) -> void {
+    auto&      ctx   = *static_cast<TableContext<Out>*>(context);
+    auto&      self  = *ctx.emitter;
+    auto const frame = PathFrame{ctx.parent, key, 0, false};
+    auto const index = self.find(frame, ctx.hint);
+    auto const entry = self.entryAt(index);
+    auto const next  = index == noEntry ? ctx.hint : index + 1;
+    switch (layoutOf(value, entry)) {
+    case Layout::section      : self.section(value, frame, entry, next); break;
+    case Layout::dotted       : self.sections(value, frame, next); break;
+    case Layout::arrayOfTables: self.arrayOfTables(value, frame, entry, next); break;
+    default                   : break;
+    }
+  }
+
+  constexpr auto sections(ValueRef table, PathFrame const& frame, std::size_t hint) -> void {
+    auto ctx = TableContext<Out>{this, &frame, nullptr, hint, 0};
+    table.forEachKeyValue(table.ptr, &ctx, &sectionEntry);
+  }
+
+  constexpr auto section(ValueRef table, PathFrame const& frame, MetaEntry const* entry, std::size_t hint) -> void {
+    pendingFrame     = &frame;
+    pendingEntry     = entry;
+    auto const count = keys(table, frame, &frame, hint);
+    if (count == 0 || (entry != nullptr && entry->explicitHeader)) {
+      flushHeader();
+    }
+    pendingFrame = nullptr;
+    sections(table, frame, hint);
+  }
+
+  constexpr auto arrayOfTables(ValueRef array, PathFrame const& frame, MetaEntry const* entry, std::size_t hint)
+    -> void {
+    auto const count = array.sizeOf(array.ptr);
+    for (std::size_t i = 0; i < count; ++i) {
+      auto const element = array.lookupByIndex(array.ptr, i);
+      auto const elemAt  = PathFrame{&frame, {}, i, true};
+      auto const index   = find(elemAt, hint);
+      auto const next    = index == noEntry ? hint : index + 1;
+      if (i == 0) {
+        leading(entry);
+      }
+      header(&elemAt, entryAt(index), true);
+      keys(element, elemAt, &elemAt, next);
+      sections(element, elemAt, next);
+    }
+  }
+
+  static constexpr auto inlineEntry(void* context, std::string_view key, ValueRef const& value) -> void {
+    auto& ctx = *static_cast<InlineContext<Out>*>(context);
+    auto& out = ctx.emitter->out;
+    out.append(ctx.first ? " " : ", ");
+    appendKey(out, key);
+    out.append(" = ");
+    ctx.emitter->inlineValue(value);
+    ctx.first = false;
+  }
+
+  constexpr auto inlineValue(ValueRef value) -> void {
+    switch (value.type) {
+    case ValueType::string   : appendBasicString(out, value.asString()); break;
+    case ValueType::integer  : json_detail::appendInt64(out, value.as<std::int64_t>()); break;
+    case ValueType::floating : appendFloat(out, value.as<double>()); break;
+    case ValueType::boolean  : out.append(value.as<bool>() ? "true" : "false"); break;
+    case ValueType::localDate: json_detail::appendDateText(out, value.as<LocalDate>()); break;
+    case ValueType::localTime: json_detail::appendTimeText(out, value.as<LocalTime>()); break;
+    case ValueType::localDateTime: {
+      auto const ldt = value.as<LocalDateTime>();
+      json_detail::appendDateText(out, ldt.date);
+      out.push_back('T');
+      json_detail::appendTimeText(out, ldt.time);
+      break;
+    }
+    case ValueType::offsetDateTime: {
+      auto const odt = value.as<OffsetDateTime>();
+      json_detail::appendDateText(out, odt.date);
+      out.push_back('T');
+      json_detail::appendTimeText(out, odt.time);
+      json_detail::appendOffsetText(out, odt.offsetMinutes);
+      break;
+    }
+    case ValueType::array: {
+      out.push_back('[');
+      auto const count = value.sizeOf(value.ptr);
+      for (std::size_t i = 0; i < count; ++i) {
+        if (i != 0) {
+          out.append(", ");
+        }
+        inlineValue(value.lookupByIndex(value.ptr, i));
+      }
+      out.push_back(']');
+      break;
+    }
+    case ValueType::table: {
+      out.push_back('{');
+      auto ctx = InlineContext<Out>{this, true};
+      value.forEachKeyValue(value.ptr, &ctx, &inlineEntry);
+      out.append(ctx.first ? "}" : " }");
+      break;
+    }
+    default: fail(std::string{"to_toml: value has no TOML representation"});
+    }
+  }
+
+  constexpr auto document(ValueRef root) -> void {
+    if (root.type != ValueType::table) {
+      fail(std::string{"to_toml: root must be a table"});
+    }
+    auto const  rootIndex = findRoot();
+    auto const* top       = entryAt(rootIndex);
+    auto const  hint      = rootIndex == noEntry ? std::size_t{0} : rootIndex + 1;
+    if (top != nullptr) {
+      leading(top);
+      started = top->leadingCount > 0;
+    }
+    auto ctx = TableContext<Out>{this, nullptr, nullptr, hint, 0};
+    root.forEachKeyValue(root.ptr, &ctx, &keyEntry);
+    ctx.hint = hint;
+    root.forEachKeyValue(root.ptr, &ctx, &sectionEntry);
+    if (top != nullptr) {
+      for (std::size_t i = 0; i < top->trailingCount; ++i) {
+        out.push_back('#');
+        out.append(std::string_view{comments[top->trailingOffset + i]});
+        out.push_back('\n');
+      }
+    }
+  }
+
+  constexpr auto findRoot() const -> std::size_t {
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+      if (std::string_view{entries[i].path} == "$") {
+        return i;
+      }
+    }
+    return noEntry;
+  }
+};
+}  // namespace toml::toml_detail
+
+#endif
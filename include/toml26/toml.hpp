@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <charconv>
 #include <concepts>
 #include <cstdint>
@@ -8,6 +9,7 @@
 #include <meta>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -15,6 +17,7 @@
 #include <utility>
 #include <vector>
 
+#include "include/scan.hpp"
 #include "include/types.hpp"
 
 namespace toml {
@@ -35,31 +38,63 @@ concept PathSegment = isKeyLike<T> || isIndexLike<T>;
 
 [[noreturn]] constexpr auto fail(std::string message) -> void { throw std::move(message); }
 
-struct ValueRef {
+struct ValueRef;
+
+// Operations shared by every handle of one representation. A `ValueRef` carries a pointer to one of these instead of
+// the function pointers themselves, so copying a handle copies three words however many operations exist.
+struct ValueOps {
   using EmitKeyValueCallback = void (*)(void* context, std::string_view key, ValueRef const& value);
   using ForEachKeyValueFn    = void    (*)(void const* object, void* context, EmitKeyValueCallback emit);
 
-  ValueType         type                                          = ValueType::none;
-  void const*       ptr                                           = nullptr;
   ValueRef          (*lookupByKey)(void const*, std::string_view) = nullptr;
   ValueRef          (*lookupByIndex)(void const*, std::size_t)    = nullptr;
   std::size_t       (*sizeOf)(void const*)                        = nullptr;
   ForEachKeyValueFn forEachKeyValue                               = nullptr;
+};
+
+inline constexpr auto scalarValueOps = ValueOps{};
+
+struct ValueRef {
+  using EmitKeyValueCallback = ValueOps::EmitKeyValueCallback;
+  using ForEachKeyValueFn    = ValueOps::ForEachKeyValueFn;
+
+  ValueType       type = ValueType::none;
+  void const*     ptr  = nullptr;
+  ValueOps const* ops  = &scalarValueOps;
+
+  // Operations the representation lacks behave as on an empty value: no entry, no element, size 0.
+  constexpr auto lookupByKey(void const* object, std::string_view key) const -> ValueRef {
+    return ops->lookupByKey != nullptr ? ops->lookupByKey(object, key) : ValueRef{};
+  }
+
+  constexpr auto lookupByIndex(void const* object, std::size_t idx) const -> ValueRef {
+    return ops->lookupByIndex != nullptr ? ops->lookupByIndex(object, idx) : ValueRef{};
+  }
+
+  constexpr auto sizeOf(void const* object) const -> std::size_t {
+    return ops->sizeOf != nullptr ? ops->sizeOf(object) : 0;
+  }
+
+  constexpr auto forEachKeyValue(void const* object, void* context, EmitKeyValueCallback emit) const -> void {
+    if (ops->forEachKeyValue != nullptr) {
+      ops->forEachKeyValue(object, context, emit);
+    }
+  }
 
   constexpr auto valid() const -> bool { return type != ValueType::none; }
 
   constexpr auto operator[](std::string_view key) const -> ValueRef {
-    if (type != ValueType::table || lookupByKey == nullptr) {
+    if (type != ValueType::table || ops->lookupByKey == nullptr) {
       fail(std::string{"invalid table key access"});
     }
-    return lookupByKey(ptr, key);
+    return ops->lookupByKey(ptr, key);
   }
 
   constexpr auto operator[](std::size_t idx) const -> ValueRef {
-    if (lookupByIndex == nullptr) {
+    if (ops->lookupByIndex == nullptr) {
       fail(std::string{"invalid array index access"});
     }
-    return lookupByIndex(ptr, idx);
+    return ops->lookupByIndex(ptr, idx);
   }
 
   template<path_detail::PathSegment First, path_detail::PathSegment... Rest>
@@ -142,7 +177,7 @@ struct ValueRef {
   template<typename Visitor>
   constexpr decltype(auto) visit(Visitor&& visitor) const {
     switch (type) {
-    case ValueType::string        : return std::forward<Visitor>(visitor)(*static_cast<char const* const*>(ptr));
+    case ValueType::string        : return std::forward<Visitor>(visitor)(asString());
     case ValueType::integer       : return std::forward<Visitor>(visitor)(*static_cast<std::int64_t const*>(ptr));
     case ValueType::floating      : return std::forward<Visitor>(visitor)(*static_cast<double const*>(ptr));
     case ValueType::boolean       : return std::forward<Visitor>(visitor)(*static_cast<bool const*>(ptr));
@@ -160,7 +195,8 @@ struct ValueRef {
     if (type != ValueType::string) {
       fail(std::string{"type mismatch for asString"});
     }
-    return std::string_view{*static_cast<char const* const*>(ptr)};
+    auto const* chars = *static_cast<char const* const*>(ptr);
+    return ops->sizeOf != nullptr ? std::string_view{chars, ops->sizeOf(ptr)} : std::string_view{chars};
   }
 
   template<typename T>
@@ -256,10 +292,10 @@ struct ValueRef {
 
  private:
   constexpr auto stepMaybe(std::string_view key) const -> std::optional<ValueRef> {
-    if (type != ValueType::table || lookupByKey == nullptr) {
+    if (type != ValueType::table || ops->lookupByKey == nullptr) {
       return std::nullopt;
     }
-    auto const next = lookupByKey(ptr, key);
+    auto const next = ops->lookupByKey(ptr, key);
     if (!next.valid()) {
       return std::nullopt;
     }
@@ -267,10 +303,10 @@ struct ValueRef {
   }
 
   constexpr auto stepMaybe(std::size_t idx) const -> std::optional<ValueRef> {
-    if (lookupByIndex == nullptr) {
+    if (ops->lookupByIndex == nullptr) {
       return std::nullopt;
     }
-    auto const next = lookupByIndex(ptr, idx);
+    auto const next = ops->lookupByIndex(ptr, idx);
     if (!next.valid()) {
       return std::nullopt;
     }
@@ -329,15 +365,7 @@ struct ValueRef {
   template<typename Table>
   static constexpr auto lookupTableIndex(void const* p, std::size_t idx) -> ValueRef {
     auto const& obj = *static_cast<Table const*>(p);
-    auto        out = ValueRef{};
-    if constexpr (requires { Table::indices(); }) {
-      template for (constexpr auto i: Table::indices()) {
-        if (!out.valid() && idx == i) {
-          out = ValueRef::from(obj.template get<i>());
-        }
-      }
-    }
-    return out;
+    return obj.indexLookup(idx);
   }
 
   template<typename Array>
@@ -359,14 +387,7 @@ struct ValueRef {
   template<typename Table>
   static constexpr auto forEachTableMapped(void const* p, void* context, EmitKeyValueCallback emit) -> void {
     auto const& obj = *static_cast<Table const*>(p);
-    if constexpr (requires {
-                    obj.begin();
-                    obj.end();
-                  }) {
-      for (auto const entry: obj) {
-        emit(context, entry.key, entry.value);
-      }
-    }
+    obj.forEach([&](std::string_view key, ValueRef const& value) { emit(context, key, value); });
   }
 
   template<typename Table>
@@ -378,6 +399,31 @@ struct ValueRef {
     }
   }
 
+  template<typename Array>
+  static constexpr auto arrayOps() -> ValueOps const& {
+    static constexpr auto instance = ValueOps{nullptr, &lookupArray<Array>, &sizeOfArray<Array>, nullptr};
+    return instance;
+  }
+
+  template<typename Table>
+  static constexpr auto mappedTableOps() -> ValueOps const& {
+    if constexpr (isPseudoArrayTable<Table>()) {
+      static constexpr auto instance =
+        ValueOps{&lookupTableMapped<Table>, &lookupTableIndex<Table>, nullptr, &forEachTableMapped<Table>};
+      return instance;
+    } else {
+      static constexpr auto instance =
+        ValueOps{&lookupTableMapped<Table>, nullptr, nullptr, &forEachTableMapped<Table>};
+      return instance;
+    }
+  }
+
+  template<typename Table>
+  static constexpr auto reflectedTableOps() -> ValueOps const& {
+    static constexpr auto instance = ValueOps{&lookupTable<Table>, nullptr, nullptr, &forEachTable<Table>};
+    return instance;
+  }
+
  public:
   static consteval auto isPseudoArrayKey(std::string_view key, std::size_t idx) -> bool {
     if (key.size() < 3 || key[0] != 'm' || key[1] != '_') {
@@ -420,40 +466,31 @@ struct ValueRef {
   static constexpr auto from(T const& value) -> ValueRef {
     using U = std::remove_cvref_t<T>;
     if constexpr (std::same_as<U, char const*>) {
-      return ValueRef{ValueType::string, std::addressof(value), nullptr, nullptr, nullptr, nullptr};
+      return ValueRef{ValueType::string, std::addressof(value)};
     } else if constexpr (std::same_as<U, std::int64_t>) {
-      return ValueRef{ValueType::integer, std::addressof(value), nullptr, nullptr, nullptr, nullptr};
+      return ValueRef{ValueType::integer, std::addressof(value)};
     } else if constexpr (std::same_as<U, double>) {
-      return ValueRef{ValueType::floating, std::addressof(value), nullptr, nullptr, nullptr, nullptr};
+      return ValueRef{ValueType::floating, std::addressof(value)};
     } else if constexpr (std::same_as<U, bool>) {
-      return ValueRef{ValueType::boolean, std::addressof(value), nullptr, nullptr, nullptr, nullptr};
+      return ValueRef{ValueType::boolean, std::addressof(value)};
     } else if constexpr (std::same_as<U, OffsetDateTime>) {
-      return ValueRef{ValueType::offsetDateTime, std::addressof(value), nullptr, nullptr, nullptr, nullptr};
+      return ValueRef{ValueType::offsetDateTime, std::addressof(value)};
     } else if constexpr (std::same_as<U, LocalDateTime>) {
-      return ValueRef{ValueType::localDateTime, std::addressof(value), nullptr, nullptr, nullptr, nullptr};
+      return ValueRef{ValueType::localDateTime, std::addressof(value)};
     } else if constexpr (std::same_as<U, LocalDate>) {
-      return ValueRef{ValueType::localDate, std::addressof(value), nullptr, nullptr, nullptr, nullptr};
+      return ValueRef{ValueType::localDate, std::addressof(value)};
     } else if constexpr (std::same_as<U, LocalTime>) {
-      return ValueRef{ValueType::localTime, std::addressof(value), nullptr, nullptr, nullptr, nullptr};
+      return ValueRef{ValueType::localTime, std::addressof(value)};
+    } else if constexpr (std::same_as<U, ValueRef>) {
+      return value;
+    } else if constexpr (requires { typename U::TomlDocumentTag; }) {
+      return value.root();
     } else if constexpr (requires { typename U::TomlArrayTag; }) {
-      return ValueRef{ValueType::array, std::addressof(value), nullptr, &lookupArray<U>, &sizeOfArray<U>, nullptr};
+      return ValueRef{ValueType::array, std::addressof(value), &arrayOps<U>()};
     } else if constexpr (requires { typename U::TomlTableTag; }) {
-      if constexpr (isPseudoArrayTable<U>()) {
-        return ValueRef{
-          ValueType::table,
-          std::addressof(value),
-          &lookupTableMapped<U>,
-          &lookupTableIndex<U>,
-          nullptr,
-          &forEachTableMapped<U>
-        };
-      } else {
-        return ValueRef{
-          ValueType::table, std::addressof(value), &lookupTableMapped<U>, nullptr, nullptr, &forEachTableMapped<U>
-        };
-      }
+      return ValueRef{ValueType::table, std::addressof(value), &mappedTableOps<U>()};
     } else if constexpr (std::is_class_v<U>) {
-      return ValueRef{ValueType::table, std::addressof(value), &lookupTable<U>, nullptr, nullptr, &forEachTable<U>};
+      return ValueRef{ValueType::table, std::addressof(value), &reflectedTableOps<U>()};
     } else {
       static_assert(!sizeof(T), "unsupported reflected member type");
     }
@@ -528,6 +565,8 @@ consteval auto operator""_i() -> CtPathIndex<parseIndexLiteralV<Chars...>> {
 }
 }  // namespace literals
 
+#include "include/path_expr.hpp"
+
 namespace path_detail {
 template<typename T>
 struct IsPathKeyType: std::false_type {};
@@ -548,7 +587,7 @@ template<typename T>
 inline constexpr bool isPathIndexTypeV = IsPathIndexType<std::remove_cvref_t<T>>::value;
 
 template<typename T>
-concept CtPathSegmentType = isPathKeyTypeV<T> || isPathIndexTypeV<T>;
+concept CtPathSegmentType = isPathKeyTypeV<T> || isPathIndexTypeV<T> || isPathExprTypeV<T>;
 
 template<auto Segment>
 inline constexpr bool isCtPathSegmentValue = CtPathSegmentType<std::remove_cvref_t<decltype(Segment)>>;
@@ -570,6 +609,8 @@ constexpr decltype(auto) ctPathStep(Obj const& obj) {
     } else {
       static_assert(requires { obj.template get<index>(); }, "compile-time index segment cannot be applied here");
     }
+  } else if constexpr (isPathExprTypeV<SegmentType>) {
+    return Segment(obj);
   } else {
     static_assert(CtPathSegmentType<SegmentType>, "unsupported compile-time path segment type");
   }
@@ -586,78 +627,82 @@ constexpr decltype(auto) ctPathGet(Obj const& obj) {
 }
 }  // namespace path_detail
 
+#include "include/float_parse.hpp"
+#include "include/float_format.hpp"
+#include "include/key_index.hpp"
 #include "include/materializer.hpp"
 #include "include/parser.hpp"
+#include "include/path_index.hpp"
+#include "include/for_each.hpp"
+
+template<typename Data, std::size_t EntryCount, std::size_t CommentCount>
+consteval auto makeParseWithMetaOutput(
+  Data const&                                  data,
+  std::array<MetaEntry, EntryCount> const&     entries,
+  std::array<char const*, CommentCount> const& comments
+) {
+  using MetaType = MetaRoot<EntryCount, CommentCount>;
+  auto meta      = MetaType{entries, comments, {}};
+  meta.global    = typename MetaType::Global{
+    1,
+    1,
+    0,
+    findRootMetaIndex(entries),
+    EntryCount,
+    CommentCount,
+  };
+  return ParseWithMetaOutput<Data, MetaType>{data, meta};
+}
 
 template<FixedString Source>
 consteval auto parse() {
-  constexpr auto err = detail::parseErrorOfText<Source>();
-  if constexpr (err != detail::ParseError::none) {
-    return detail::failParseValue<err>();
+  constexpr auto doc = reflectDocument(Source.view(), false);
+  if constexpr (doc.error != detail::ParseError::none) {
+    return detail::failParseValue<doc.error>();
   } else {
-    return [:parseAsReflection(Source.view()):];
+    return [:doc.data:];
   }
 }
 
 template<auto SourceBytes>
 consteval auto parse() {
-  constexpr auto err = detail::parseErrorOfBytes<SourceBytes>();
-  if constexpr (err != detail::ParseError::none) {
-    return detail::failParseValue<err>();
+  constexpr std::string_view sourceView{SourceBytes};
+  constexpr auto             doc = reflectDocument(sourceView, false);
+  if constexpr (doc.error != detail::ParseError::none) {
+    return detail::failParseValue<doc.error>();
   } else {
-    constexpr std::string_view sourceView{SourceBytes};
-    return [:parseAsReflection(sourceView):];
+    return [:doc.data:];
   }
 }
 
 template<FixedString Source>
 consteval auto parse_with_meta() {
-  constexpr auto err = detail::parseErrorOfText<Source>();
-  if constexpr (err != detail::ParseError::none) {
-    return detail::failParseValue<err>();
+  constexpr auto doc = reflectDocument(Source.view(), true);
+  if constexpr (doc.error != detail::ParseError::none) {
+    return detail::failParseValue<doc.error>();
   } else {
-    auto data      = [:parseAsReflection(Source.view()):];
-    auto entries   = [:parseMetaAsReflection(Source.view()):];
-    auto comments  = [:parseCommentsAsReflection(Source.view()):];
-    using MetaType = MetaRoot<std::tuple_size_v<decltype(entries)>, std::tuple_size_v<decltype(comments)>>;
-    auto meta      = MetaType{entries, comments, {}};
-    meta.global    = typename MetaType::Global{
-      1,
-      1,
-      0,
-      findRootMetaIndex(entries),
-      std::tuple_size_v<decltype(entries)>,
-      std::tuple_size_v<decltype(comments)>,
-    };
-    return ParseWithMetaOutput<decltype(data), MetaType>{data, meta};
+    return makeParseWithMetaOutput([:doc.data:], [:doc.entries:], [:doc.comments:]);
   }
 }
 
 template<auto SourceBytes>
 consteval auto parse_with_meta() {
-  constexpr auto err = detail::parseErrorOfBytes<SourceBytes>();
-  if constexpr (err != detail::ParseError::none) {
-    return detail::failParseValue<err>();
+  constexpr std::string_view sourceView{SourceBytes};
+  constexpr auto             doc = reflectDocument(sourceView, true);
+  if constexpr (doc.error != detail::ParseError::none) {
+    return detail::failParseValue<doc.error>();
   } else {
-    constexpr std::string_view sourceView{SourceBytes};
-    auto                       data     = [:parseAsReflection(sourceView):];
-    auto                       entries  = [:parseMetaAsReflection(sourceView):];
-    auto                       comments = [:parseCommentsAsReflection(sourceView):];
-    using MetaType = MetaRoot<std::tuple_size_v<decltype(entries)>, std::tuple_size_v<decltype(comments)>>;
-    auto meta      = MetaType{entries, comments, {}};
-    meta.global    = typename MetaType::Global{
-      1,
-      1,
-      0,
-      findRootMetaIndex(entries),
-      std::tuple_size_v<decltype(entries)>,
-      std::tuple_size_v<decltype(comments)>,
-    };
-    return ParseWithMetaOutput<decltype(data), MetaType>{data, meta};
+    return makeParseWithMetaOutput([:doc.data:], [:doc.entries:], [:doc.comments:]);
   }
 }
 }  // namespace toml
 
 #include "include/embed.hpp"
+#include "include/bind.hpp"
 #include "include/json.hpp"
+#include "include/serialize.hpp"
+#include "include/document.hpp"
+#include "include/sax.hpp"
+#include "include/stream.hpp"
+#include "include/load.hpp"
 
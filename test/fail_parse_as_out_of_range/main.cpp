@@ -0,0 +1,16 @@
+#include <array>
+#include <cstdint>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+struct Config {
+  std::uint16_t port = 0;
+};
+
+constexpr auto cfg = toml::parse_as<Config, sourceBytes>();
+
+auto main() -> int {}
@@ -0,0 +1,18 @@
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+struct Config {
+  std::string_view host;
+  std::int64_t     port = 80;
+};
+
+constexpr auto cfg = toml::parse_as<Config, sourceBytes>();
+
+auto main() -> int {}
@@ -0,0 +1,86 @@
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr auto cfg = toml::parseEmbed<sourceBytes>();
+
+consteval auto valuesMatch() -> bool {
+  auto const values = cfg["values"];
+  for (std::size_t i = 0; i < 512; ++i) {
+    if (values[i].as_or<std::int64_t>(-1) != static_cast<std::int64_t>(i * 3)) {
+      return false;
+    }
+  }
+  return !values[512].valid();
+}
+
+// `values` is homogeneous and becomes a ScalarArrayObject; this one mixes integers and floats so the large
+// ArrayObject accessor path stays covered.
+consteval auto largeMixedMatch() -> bool {
+  auto const mixed = cfg["large_mixed"];
+  for (std::size_t i = 0; i < 512; ++i) {
+    auto const ok = i % 2 == 0 ? mixed[i].as_or<std::int64_t>(-1) == static_cast<std::int64_t>(i * 3)
+                               : mixed[i].as_or<double>(-1.0) == static_cast<double>(i * 3) + 0.5;
+    if (!ok) {
+      return false;
+    }
+  }
+  return !mixed[512].valid();
+}
+
+auto main() -> int {
+  static_assert(valuesMatch());
+  static_assert(cfg.values.size() == 512);
+  static_assert(cfg.values[511].as_or<std::int64_t>(0) == 1533);
+  static_assert(largeMixedMatch());
+  static_assert(cfg.large_mixed.size() == 512);
+  static_assert(cfg.large_mixed[511].as_or<double>(0.0) == 1533.5);
+  static_assert(cfg["mixed"][0].as_or<std::int64_t>(0) == 1);
+  static_assert(cfg["mixed"][1].asString() == "two");
+  static_assert(cfg["mixed"][2].as_or<double>(0.0) == 3.0);
+  static_assert(cfg["mixed"][3].as_or<bool>(false));
+  static_assert(cfg["mixed"][4][0].as_or<std::int64_t>(0) == 5);
+  static_assert(cfg["mixed"][5]["six"].as_or<std::int64_t>(0) == 6);
+  static_assert(!cfg["mixed"][6].valid());
+  static_assert(cfg["pseudo"][2].asString() == "two");
+  static_assert(!cfg["pseudo"][4].valid());
+
+  std::int64_t sum   = 0;
+  std::size_t  count = 0;
+  for (auto v: cfg.values) {
+    if (v.as_or<std::int64_t>(-1) != static_cast<std::int64_t>(count * 3)) {
+      return 1;
+    }
+    sum += v.as_or<std::int64_t>(0);
+    ++count;
+  }
+  if (count != 512 || sum != 3 * 511 * 512 / 2) {
+    return 1;
+  }
+
+  std::size_t mixedCount = 0;
+  for (auto v: cfg.large_mixed) {
+    if (!v.valid()) {
+      return 1;
+    }
+    ++mixedCount;
+  }
+  if (mixedCount != 512) {
+    return 1;
+  }
+
+  std::size_t keys = 0;
+  for (auto const& entry: cfg.pseudo) {
+    if (cfg["pseudo"][keys].asString() != entry.value.asString()) {
+      return 1;
+    }
+    ++keys;
+  }
+  return keys == 4 ? 0 : 1;
+}
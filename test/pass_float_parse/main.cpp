@@ -0,0 +1,112 @@
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr auto cfg = toml::parseEmbed<sourceBytes>();
+
+namespace {
+struct Corpus {
+  std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+  auto next() -> std::uint64_t {
+    state ^= state << 13U;
+    state ^= state >> 7U;
+    state ^= state << 17U;
+    return state;
+  }
+
+  auto nextFinite() -> double {
+    while (true) {
+      auto const value = std::bit_cast<double>(next());
+      if (std::isfinite(value)) {
+        return value;
+      }
+    }
+  }
+};
+
+auto sameBits(double a, double b) -> bool { return std::bit_cast<std::uint64_t>(a) == std::bit_cast<std::uint64_t>(b); }
+
+auto appendFormatted(std::string& out, double value, std::chars_format format, int precision) -> void {
+  auto buffer = std::array<char, 1024>{};
+  auto const end =
+    precision < 0 ? std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, format).ptr
+                  : std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, format, precision).ptr;
+  auto text = std::string_view{buffer.data(), static_cast<std::size_t>(end - buffer.data())};
+  if (text.find_first_of(".e") == std::string_view::npos) {
+    out.append(text).append(".0");
+  } else {
+    out.append(text);
+  }
+}
+}  // namespace
+
+auto main() -> int {
+  static_assert(cfg.tenth == 0.1);
+  static_assert(cfg.third == 1.0 / 3.0);
+  static_assert(cfg.above_halfway == 9007199254740994.0);
+  static_assert(cfg.halfway_even == 9007199254740992.0);
+  static_assert(cfg.halfway_odd == 9007199254740996.0);
+  static_assert(cfg.long_mantissa == 0.1);
+  static_assert(cfg.min_normal == std::numeric_limits<double>::min());
+  static_assert(cfg.max_subnormal == std::nextafter(std::numeric_limits<double>::min(), 0.0));
+  static_assert(cfg.min_subnormal == std::numeric_limits<double>::denorm_min());
+  static_assert(cfg.below_min_subnormal == 0.0);
+  static_assert(cfg.above_min_subnormal == std::numeric_limits<double>::denorm_min());
+  static_assert(cfg.max_double == std::numeric_limits<double>::max());
+  static_assert(cfg.overflow == std::numeric_limits<double>::infinity());
+  static_assert(cfg.underflow == 0.0);
+  static_assert(std::signbit(cfg.negative_zero));
+
+  auto const doc = toml::parse_runtime(std::string_view{sourceBytes.data(), sourceBytes.size()});
+  if (!sameBits(doc["above_halfway"].as<double>(), cfg.above_halfway)
+      || !sameBits(doc["max_subnormal"].as<double>(), cfg.max_subnormal)
+      || !sameBits(doc["negative_zero"].as<double>(), cfg.negative_zero)) {
+    return 1;
+  }
+
+  constexpr auto formats = std::array<std::pair<std::chars_format, int>, 4>{{
+    {std::chars_format::general, -1},
+    {std::chars_format::scientific, 16},
+    {std::chars_format::scientific, 40},
+    {std::chars_format::scientific, 330},
+  }};
+  auto corpus   = Corpus{};
+  auto expected = std::vector<double>{};
+  auto source   = std::string{"values = [\n"};
+  for (int i = 0; i < 20'000; ++i) {
+    auto const value = corpus.nextFinite();
+    for (auto const [format, precision]: formats) {
+      auto const start = source.size();
+      appendFormatted(source, value, format, precision);
+      auto parsed = 0.0;
+      std::from_chars(source.data() + start, source.data() + source.size(), parsed);
+      expected.push_back(parsed);
+      source.append(",\n");
+    }
+  }
+  source.append("]\n");
+
+  auto const values = toml::parse_runtime(source)["values"];
+  if (values.sizeOf(values.ptr) != expected.size()) {
+    return 2;
+  }
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    if (!sameBits(values[i].as<double>(), expected[i])) {
+      return 3;
+    }
+  }
+}
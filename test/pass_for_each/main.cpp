@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr auto cfg = toml::parseEmbed<sourceBytes>();
+
+template<typename Value, typename T>
+constexpr bool isA = std::same_as<std::remove_cvref_t<Value>, T>;
+
+// Direct children with their real member types: the integer arrives as `std::int64_t const&`, the string as
+// `char const*`, nested tables and arrays as their generated types.
+static_assert([] {
+  auto keys     = std::string{};
+  auto port     = std::int64_t{0};
+  auto typedAll = true;
+  toml::for_each(cfg, [&](std::string_view key, auto const& value) {
+    keys += key;
+    keys += ';';
+    if constexpr (isA<decltype(value), std::int64_t>) {
+      port = value;
+    } else if constexpr (isA<decltype(value), char const*>) {
+      typedAll = typedAll && key == "name";
+    } else {
+      typedAll = typedAll && (key == "limits" || key == "hosts");
+    }
+  });
+  return keys == "name;port;limits;hosts;" && port == 8080 && typedAll;
+}());
+
+static_assert([] {
+  auto sum = std::int64_t{0};
+  toml::for_each(cfg.limits.ports, [&](std::size_t index, std::int64_t const& value) {
+    sum += static_cast<std::int64_t>(index + 1) * value;
+  });
+  return sum == 80 + 2 * 443;
+}());
+
+static_assert([] {
+  auto hosts = std::size_t{0};
+  toml::for_each(cfg.hosts, [&](std::size_t, auto const& host) { hosts += std::string_view{host.ip}.size(); });
+  return hosts == 16;
+}());
+
+// Leaves in document order, each with its canonical path.
+static_assert([] {
+  auto paths = std::vector<std::string>{};
+  toml::for_each_leaf(cfg, [&](std::string_view path, auto const&) { paths.emplace_back(path); });
+  auto const expected = std::array<std::string_view, 7>{
+    "name",
+    "port",
+    "limits.ratio",
+    "limits.ports[0]",
+    "limits.ports[1]",
+    "hosts[0].ip",
+    "hosts[1].ip",
+  };
+  return std::ranges::equal(paths, expected);
+}());
+
+static_assert([] {
+  auto ratio = 0.0;
+  toml::for_each_leaf(cfg.limits, [&](std::string_view path, auto const& value) {
+    if constexpr (isA<decltype(value), double>) {
+      ratio = path == "ratio" ? value : -1.0;
+    }
+  });
+  return ratio == 0.5;
+}());
+
+struct Settings {
+  std::int64_t port  = 0;
+  double       ratio = 0.0;
+};
+
+auto main() -> int {
+  auto settings = Settings{};
+  toml::for_each_leaf(cfg, [&](std::string_view path, auto const& value) {
+    if constexpr (isA<decltype(value), std::int64_t>) {
+      if (path == "port") {
+        settings.port = value;
+      }
+    } else if constexpr (isA<decltype(value), double>) {
+      settings.ratio = value;
+    }
+  });
+  if (settings.port != 8080 || settings.ratio != 0.5) {
+    return 1;
+  }
+}
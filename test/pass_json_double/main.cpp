@@ -0,0 +1,69 @@
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr auto jsonCt = toml::to_json<sourceBytes>();
+
+static_assert(std::string_view{jsonCt}.find("\"tenth\":0.1,") != std::string_view::npos);
+static_assert(std::string_view{jsonCt}.find("\"third\":0.3333333333333333,") != std::string_view::npos);
+static_assert(std::string_view{jsonCt}.find("\"whole\":3,") != std::string_view::npos);
+static_assert(std::string_view{jsonCt}.find("\"big\":1e+21,") != std::string_view::npos);
+static_assert(std::string_view{jsonCt}.find("\"below_big\":100000000000000000000,") != std::string_view::npos);
+static_assert(std::string_view{jsonCt}.find("\"small\":1.5e-7,") != std::string_view::npos);
+static_assert(std::string_view{jsonCt}.find("\"micro\":0.000001,") != std::string_view::npos);
+static_assert(std::string_view{jsonCt}.find("\"min_subnormal\":5e-324,") != std::string_view::npos);
+static_assert(std::string_view{jsonCt}.find("\"max_double\":1.7976931348623157e+308,") != std::string_view::npos);
+static_assert(std::string_view{jsonCt}.find("\"negative_zero\":-0}") != std::string_view::npos);
+
+namespace {
+auto significantDigits(std::string_view text) -> std::string {
+  auto digits = std::string{};
+  for (char const c: text.substr(0, text.find('e'))) {
+    if (c >= '0' && c <= '9' && !(digits.empty() && c == '0')) {
+      digits.push_back(c);
+    }
+  }
+  while (digits.size() > 1 && digits.back() == '0') {
+    digits.pop_back();
+  }
+  return digits;
+}
+}  // namespace
+
+auto main() -> int {
+  auto state = std::uint64_t{0x2545F4914F6CDD1DULL};
+  for (int i = 0; i < 200'000; ++i) {
+    state ^= state << 13U;
+    state ^= state >> 7U;
+    state ^= state << 17U;
+    auto const value = std::bit_cast<double>(state);
+    if (!std::isfinite(value)) {
+      continue;
+    }
+    auto const json = toml::to_json(value);
+    auto       back = 0.0;
+    std::from_chars(json.data(), json.data() + json.size(), back);
+    if (std::bit_cast<std::uint64_t>(back) != state) {
+      return 1;
+    }
+    auto       reference = std::array<char, 64>{};
+    auto*      first     = reference.data();
+    auto const result    = std::to_chars(first, first + reference.size(), value, std::chars_format::scientific);
+    if (significantDigits(json) != significantDigits(std::string_view{first, result.ptr})) {
+      return 2;
+    }
+  }
+  if (toml::to_json(std::nan("")) != "null" || toml::to_json(-HUGE_VAL) != "null") {
+    return 3;
+  }
+}
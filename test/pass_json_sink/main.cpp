@@ -0,0 +1,93 @@
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <iterator>
+#include <new>
+#include <string>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr auto cfg = toml::parseEmbed<sourceBytes>();
+
+constexpr auto jsonCt = [] {
+  auto out = toml::JsonBuffer<512>{};
+  toml::to_json(cfg, out);
+  return out;
+}();
+
+static_assert(toml::json_size(cfg) == std::string_view{jsonCt}.size());
+static_assert(toml::json_size(cfg, {.pretty = true}) == toml::to_json(cfg, {.pretty = true}).size());
+static_assert(std::string_view{jsonCt} == std::string_view{toml::to_json<sourceBytes>()});
+static_assert(std::string_view{jsonCt}.find("\"name\":\"sink \\\"quoted\\\"\\ttab\"") != std::string_view::npos);
+static_assert(std::string_view{jsonCt}.find("\"when\":\"1979-05-27T07:32:00.5-07:00\"") != std::string_view::npos);
+static_assert(std::string_view{jsonCt}.find("\"clock\":\"07:32:00.00025\"") != std::string_view::npos);
+
+namespace {
+std::size_t allocationCount = 0;
+}  // namespace
+
+auto operator new(std::size_t size) -> void* {
+  ++allocationCount;
+  if (auto* p = std::malloc(size == 0 ? 1 : size)) {
+    return p;
+  }
+  throw std::bad_alloc{};
+}
+auto operator delete(void* p) noexcept -> void { std::free(p); }
+auto operator delete(void* p, std::size_t) noexcept -> void { std::free(p); }
+
+auto main() -> int {
+  auto const doc      = toml::parse_runtime(std::string_view{sourceBytes.data(), sourceBytes.size()});
+  auto const expected = std::string_view{jsonCt};
+  if (toml::to_json(doc) != expected || toml::json_size(doc) != expected.size()) {
+    return 1;
+  }
+
+  auto reserved = std::string{};
+  reserved.reserve(toml::json_size(doc));
+  auto fixed  = std::array<char, 512>{};
+  auto buffer = toml::JsonBuffer<512>{};
+
+  auto const before = allocationCount;
+  toml::to_json(doc, reserved);
+  auto* const end = toml::to_json(doc, fixed.data());
+  toml::to_json(doc, buffer);
+  if (allocationCount != before) {
+    return 2;
+  }
+  if (reserved != expected || std::string_view{fixed.data(), end} != expected || buffer.view() != expected) {
+    return 3;
+  }
+
+  auto appended = std::string{};
+  toml::to_json(doc, std::back_inserter(appended), {.pretty = true});
+  if (appended != toml::to_json(cfg, {.pretty = true})) {
+    return 4;
+  }
+
+#if TOML26_HAS_FD_WRITER
+  auto ends = std::array<int, 2>{};
+  if (::pipe(ends.data()) != 0) {
+    return 5;
+  }
+  auto writer = toml::JsonFdWriter{ends[1]};
+  toml::to_json(doc, writer);
+  ::close(ends[1]);
+  auto piped = std::string{};
+  auto chunk = std::array<char, 256>{};
+  auto got   = ::read(ends[0], chunk.data(), chunk.size());
+  while (got > 0) {
+    piped.append(chunk.data(), static_cast<std::size_t>(got));
+    got = ::read(ends[0], chunk.data(), chunk.size());
+  }
+  ::close(ends[0]);
+  if (piped != expected) {
+    return 6;
+  }
+#endif
+}
@@ -22,6 +22,8 @@ auto main() -> int {
   static_assert(std::string_view{cfg.get<"size">()} == "v_size");
   static_assert(std::string_view{cfg.get<"indices">()} == "v_indices");
   static_assert(std::string_view{cfg.get<"key">()} == "v_key");
+  static_assert(std::string_view{cfg.get<"forEach">()} == "v_forEach");
+  static_assert(std::string_view{cfg.get<"indexOf">()} == "v_indexOf");
   static_assert(std::string_view{cfg.get<"return">()} == "v_return");
   static_assert(std::string_view{cfg.get<"m_0">()} == "v_m0");
   static_assert(std::string_view{cfg.get<"m_1">()} == "v_m1");
@@ -36,6 +38,8 @@ auto main() -> int {
     && cfg["size"].asString() == "v_size"
     && cfg["indices"].asString() == "v_indices"
     && cfg["key"].asString() == "v_key"
+    && cfg["forEach"].asString() == "v_forEach"
+    && cfg["indexOf"].asString() == "v_indexOf"
     && cfg["return"].asString() == "v_return"
     && cfg["m_0"].asString() == "v_m0"
     && cfg["m_1"].asString() == "v_m1"
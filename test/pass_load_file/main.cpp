@@ -0,0 +1,68 @@
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+namespace {
+auto inside(std::string_view text, std::string_view buffer) -> bool {
+  return text.data() >= buffer.data() && text.data() + text.size() <= buffer.data() + buffer.size();
+}
+}  // namespace
+
+auto main() -> int {
+  auto const path = std::filesystem::path{__FILE__}.parent_path() / "case.toml";
+  auto const doc  = toml::load_file(path);
+
+  if (doc.source.size() != std::filesystem::file_size(path)) {
+    return 1;
+  }
+#if TOML26_HAS_MMAP
+  if (doc.mapping == nullptr) {
+    return 1;
+  }
+#endif
+  if (toml::to_json(doc) != toml::to_json<sourceBytes>()) {
+    return 2;
+  }
+
+  auto const records = doc["records"];
+  if (records.sizeOf(records.ptr) != 3 || records[2]["id"].as<std::int64_t>() != 3) {
+    return 3;
+  }
+  if (!inside(records[0]["name"].asString(), doc.source) || inside(records[2]["name"].asString(), doc.source)) {
+    return 4;
+  }
+  if (records[2]["name"].asString() != "gamma!" || records[1]["tags"].sizeOf(records[1]["tags"].ptr) != 0) {
+    return 5;
+  }
+
+  try {
+    (void)toml::load_file(path.parent_path() / "missing.toml");
+    return 6;
+  } catch (std::string const& message) {
+    if (!message.starts_with("load_file: cannot open ")) {
+      return 7;
+    }
+  }
+
+  auto const broken = std::filesystem::temp_directory_path() / "toml26_pass_load_file_broken.toml";
+  std::ofstream{broken, std::ios::binary} << "a = 1\na = 2\n";
+  try {
+    (void)toml::load_file(broken);
+    std::filesystem::remove(broken);
+    return 8;
+  } catch (std::string const& message) {
+    std::filesystem::remove(broken);
+    if (message != "load_file: E_DKEY at line 2, column 1") {
+      return 9;
+    }
+  }
+}
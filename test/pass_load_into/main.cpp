@@ -0,0 +1,81 @@
+#include <array>
+#include <concepts>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr auto cfg = toml::parseEmbed<sourceBytes>();
+
+auto rejects(std::string_view text, std::string_view reason) -> bool {
+  try {
+    static_cast<void>(toml::load_into<decltype(cfg)>(text));
+  } catch (std::string const& message) {
+    return message.find(reason) != std::string::npos;
+  }
+  return false;
+}
+
+auto main() -> int {
+  // Same keys in another order and with other values, dotted keys and an inline table.
+  auto const loaded = toml::load_into<decltype(cfg)>(
+    "ports = [9000, 9001]\n"
+    "title = \"deployed\"\n"
+    "physical = { color = \"blue\", shape = \"square\", ratio = 1.5 }\n"
+    "[owner]\n"
+    "tags = [\"b\", 2]\n"
+    "name = \"sre\\tteam\"\n"
+    "since = 2024-06-30\n"
+    "[[servers]]\n"
+    "host = \"gamma\"\n"
+    "enabled = false\n"
+    "[[servers]]\n"
+    "enabled = true\n"
+    "host = \"delta\"\n"
+  );
+  static_assert(std::same_as<std::remove_cvref_t<decltype(*loaded)>, std::remove_cv_t<decltype(cfg)>>);
+  if (std::string_view{loaded->title} != "deployed" || loaded->ports.get<1>() != 9001) {
+    return 1;
+  }
+  if (std::string_view{loaded->physical.color} != "blue" || loaded->physical.ratio != 1.5) {
+    return 1;
+  }
+  if (std::string_view{loaded->owner.name} != "sre\tteam" || loaded->owner.since.year != 2024) {
+    return 1;
+  }
+  if (loaded->owner.tags.get<1>() != 2 || std::string_view{loaded->owner.tags.get<0>()} != "b") {
+    return 1;
+  }
+  if (std::string_view{loaded->servers.get<1>().host} != "delta" || !loaded->servers.get<1>().enabled) {
+    return 1;
+  }
+  if (toml::to_json(*loaded).find("\"color\":\"blue\"") == std::string::npos) {
+    return 1;
+  }
+
+  // The reference source itself loads back to the compile-time values.
+  auto const reference = toml::load_into<decltype(cfg)>(std::string_view{sourceBytes.data(), sourceBytes.size()});
+  if (toml::to_json(*reference) != toml::to_json(cfg)) {
+    return 1;
+  }
+
+  auto const full = std::string{sourceBytes.data(), sourceBytes.size()};
+  auto const base = full.substr(0, full.find("[physical]"));
+  auto const rest = full.substr(full.find("[physical]"));
+  if (!rejects(full + "extra = 1\n", "not in the shape")
+      || !rejects(base + rest.substr(0, rest.find("color")) + "colour" + rest.substr(rest.find("color") + 5),
+                  "not in the shape")
+      || !rejects("title = 1\n" + full.substr(full.find("ports")), "title has a different type")
+      || !rejects("title = \"x\"\nports = [1]\n" + rest, "fewer elements")
+      || !rejects("title = \"x\"\nports = [1, 2, 3]\n" + rest, "more elements")
+      || !rejects(full + "[[servers]]\nhost = \"x\"\nenabled = true\n", "more elements")
+      || !rejects("ports = [1, 2]\n" + rest, "missing key title")
+      || !rejects("title = \"x\"\n" + full, "defined twice")) {
+    return 1;
+  }
+}
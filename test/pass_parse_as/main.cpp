@@ -0,0 +1,59 @@
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+struct Limits {
+  std::uint16_t connections = 0;
+  float         timeout     = 0.0F;
+  std::int32_t  retries     = 3;
+};
+
+struct ServerConfig {
+  std::string_view            name;
+  std::uint16_t               port = 0;
+  std::int32_t                workers;
+  double                      ratio = 0.0;
+  bool                        verbose;
+  std::array<double, 3>       weights;
+  toml::LocalDate             started;
+  Limits                      limits;
+  std::optional<std::int64_t> seed;
+  char const*                 region = "local";
+};
+
+constexpr auto cfg = toml::parse_as<ServerConfig, sourceBytes>();
+
+static_assert(cfg.name == "edge");
+static_assert(cfg.port == 8443);
+static_assert(cfg.workers == 12);
+static_assert(cfg.ratio == 3.0);
+static_assert(cfg.verbose);
+static_assert(cfg.weights[1] == 2.5 && cfg.weights[2] == 4.0);
+static_assert(cfg.started.year == 2024 && cfg.started.month == 5 && cfg.started.day == 1);
+static_assert(cfg.limits.connections == 40000);
+static_assert(cfg.limits.timeout == 2.5F);
+static_assert(cfg.limits.retries == 3);
+static_assert(!cfg.seed.has_value());
+static_assert(std::string_view{cfg.region} == "local");
+
+struct Endpoint {
+  std::string_view host;
+  std::int64_t     port = 80;
+};
+
+constexpr auto endpoint = toml::parse_as<Endpoint, "host = \"example.org\"">();
+
+static_assert(endpoint.host == "example.org" && endpoint.port == 80);
+
+auto main() -> int {
+  if (cfg.port != 8443 || cfg.name != "edge" || endpoint.port != 80) {
+    return 1;
+  }
+}
@@ -0,0 +1,72 @@
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "toml26/toml.hpp"
+using namespace toml::literals;
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr auto cfg = toml::parseEmbed<sourceBytes>();
+
+static_assert(std::is_same_v<decltype(toml::path<"server.limits.ports[3]">(cfg)), std::int64_t const&>);
+static_assert(&toml::path<"server.limits.ratio">(cfg) == &cfg.server.limits.ratio);
+static_assert(&toml::path<"server.limits">(cfg) == &cfg.server.limits);
+static_assert(toml::path<"server.limits.ports[3]">(cfg) == 8083);
+static_assert(std::string_view{toml::path<"contributors[1].name">(cfg)} == "Bar");
+static_assert(std::string_view{toml::path<"contributors[1].tags[1]">(cfg)} == "review");
+static_assert(toml::path<"contributors[1].'eu west'.zone">(cfg) == 3);
+static_assert(toml::path<"contributors[1].\"eu west\".zone">(cfg) == 3);
+static_assert(toml::path<"\"dotted.key\"">(cfg) == 7);
+static_assert(&toml::path<"">(cfg) == &cfg);
+static_assert(cfg.get<toml::path<"server.limits">, "ports"_k, 0_i>() == 8080);
+static_assert(toml::path_detail::parsePathSpec("a.\"b\\\"c\"[12].d").size() == 4);
+static_assert(toml::path_detail::parsePathSpec("a.\"b\\\"c\"[12].d")[1].key == "b\"c");
+static_assert(toml::path_detail::parsePathSpec("a.\"b\\\"c\"[12].d")[2].index == 12);
+
+auto main() -> int {
+  auto const doc = toml::parse_runtime(std::string_view{sourceBytes.data(), sourceBytes.size()});
+
+  auto name = toml::CompiledPath{"contributors[1].name"};
+  auto zone = toml::CompiledPath{"contributors[1].'eu west'.zone"};
+  if (!name.bind(doc) || !zone.bind(doc)) {
+    return 1;
+  }
+  if (name(doc).asString() != "Bar" || zone(doc).as<std::int64_t>() != 3) {
+    return 1;
+  }
+
+  // Unbound and foreign documents still resolve, through the hashed lookup.
+  auto const other = toml::parse_runtime("x = 1\n[server.limits]\nratio = 0.25\n");
+  auto       ratio = toml::CompiledPath{"server.limits.ratio"};
+  if (ratio(doc).as<double>() != 0.5 || !ratio.bind(doc) || ratio(other).as<double>() != 0.25) {
+    return 1;
+  }
+  // Same shape reparsed into the same buffer: the bound slot now holds a different key at the same address.
+  auto buffer  = std::string{"[s]\nab = 1\ncd = 2\n"};
+  auto cd      = toml::CompiledPath{"s.cd"};
+  auto before  = toml::parse_borrowed(buffer);
+  auto boundCd = cd.bind(before) && cd(before).as<std::int64_t>() == 2;
+  buffer.replace(0, buffer.size(), "[s]\ncd = 3\nab = 4\n");
+  auto const after = toml::parse_borrowed(buffer);
+  if (!boundCd || cd(after).as<std::int64_t>() != 3) {
+    return 1;
+  }
+  if (toml::CompiledPath{"server.missing"}(doc).valid() || toml::CompiledPath{"title[0]"}(doc).valid()) {
+    return 1;
+  }
+
+  auto rejected = false;
+  try {
+    toml::CompiledPath{"a..b"};
+  } catch (std::string const&) {
+    rejected = true;
+  }
+  if (!rejected) {
+    return 1;
+  }
+}
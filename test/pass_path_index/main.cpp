@@ -0,0 +1,61 @@
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr auto cfg   = toml::parseEmbed<sourceBytes>();
+constexpr auto index = toml::make_path_index<cfg>();
+
+constexpr auto expected = std::array<std::string_view, 12>{
+  "name",
+  "\"dotted.key\"",
+  "server",
+  "server.limits",
+  "server.limits.ports",
+  "server.limits.ports[0]",
+  "server.limits.ports[1]",
+  "server.limits.ratio",
+  "hosts",
+  "hosts[0]",
+  "hosts[0].ip",
+  "hosts[1]",
+};
+
+constexpr auto ratioId = index.id<"server.limits.ratio">();
+constexpr auto portId  = index.id<"server.limits.ports[1]">();
+
+static_assert(index.size() == 13);
+static_assert([] {
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    if (index.paths[i] != expected[i]) {
+      return false;
+    }
+  }
+  return index.paths[12] == "hosts[1].ip";
+}());
+static_assert(index[ratioId].type == toml::ValueType::floating);
+static_assert(index[ratioId].as<double>() == 0.5);
+static_assert(index[portId].as<std::int64_t>() == 8081);
+static_assert(index.path(portId) == "server.limits.ports[1]");
+static_assert(index.find("hosts[1].ip").asString() == "10.0.0.2");
+static_assert(index.find("\"dotted.key\"").as<std::int64_t>() == 7);
+static_assert(index.find("server").type == toml::ValueType::table);
+static_assert(index.find("server.limits.ports").type == toml::ValueType::array);
+static_assert(!index.find("server.missing").valid());
+static_assert(!index.id("dotted.key").has_value());
+
+auto main() -> int {
+  auto const lookup = [](std::string_view path) { return index.find(path); };
+  if (lookup("server.limits.ports[0]").as<std::int64_t>() != 8080 || lookup("hosts[0].ip").asString() != "10.0.0.1") {
+    return 1;
+  }
+  auto const id = index.id("name");
+  if (!id.has_value() || index[*id].asString() != "edge" || index[ratioId].as<double>() != 0.5) {
+    return 1;
+  }
+}
@@ -0,0 +1,88 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+namespace {
+std::size_t allocationCount = 0;
+
+auto countedAllocate(std::size_t size, std::size_t alignment) -> void* {
+  ++allocationCount;
+  auto const rounded = (size + alignment - 1) / alignment * alignment;
+  if (auto* p = std::aligned_alloc(alignment, rounded == 0 ? alignment : rounded)) {
+    return p;
+  }
+  throw std::bad_alloc{};
+}
+
+auto inside(std::string_view text, std::string_view buffer) -> bool {
+  return text.data() >= buffer.data() && text.data() + text.size() <= buffer.data() + buffer.size();
+}
+
+auto keysInside(toml::ValueRef table, std::string_view buffer) -> std::size_t {
+  struct Context {
+    std::string_view buffer;
+    std::size_t      count;
+  } ctx{buffer, 0};
+  table.forEachKeyValue(table.ptr, &ctx, [](void* context, std::string_view key, toml::ValueRef const&) {
+    auto& c = *static_cast<Context*>(context);
+    c.count += inside(key, c.buffer) ? 1 : 0;
+  });
+  return ctx.count;
+}
+}  // namespace
+
+auto operator new(std::size_t size) -> void* { return countedAllocate(size, alignof(std::max_align_t)); }
+auto operator new(std::size_t size, std::align_val_t alignment) -> void* {
+  return countedAllocate(size, static_cast<std::size_t>(alignment));
+}
+auto operator delete(void* p) noexcept -> void { std::free(p); }
+auto operator delete(void* p, std::size_t) noexcept -> void { std::free(p); }
+auto operator delete(void* p, std::align_val_t) noexcept -> void { std::free(p); }
+auto operator delete(void* p, std::size_t, std::align_val_t) noexcept -> void { std::free(p); }
+
+auto main() -> int {
+  auto const source = std::string_view{sourceBytes.data(), sourceBytes.size()};
+
+  auto const before   = allocationCount;
+  auto const borrowed = toml::parse_borrowed(source);
+  auto const used     = allocationCount - before;
+  if (used > 2) {
+    return 1;
+  }
+
+  auto const viewsOk = borrowed.source.data() == source.data()
+                    && inside(borrowed["name"].asString(), source)
+                    && inside(borrowed["path"].asString(), source)
+                    && inside(borrowed["banner"].asString(), source)
+                    && inside(borrowed["server"]["limits"]["memory"].asString(), source)
+                    && !inside(borrowed["escaped"].asString(), source)
+                    && borrowed["escaped"].asString() == "line\nbreak"
+                    && borrowed["path"].asString() == "C:\\srv\\edge"
+                    && borrowed["banner"].asString() == "welcome"
+                    && borrowed["escaped\tkey"].as<std::int64_t>() == 3;
+  if (!viewsOk) {
+    return 2;
+  }
+
+  if (keysInside(borrowed.root(), source) != 7 || keysInside(borrowed["server"], source) != 3) {
+    return 3;
+  }
+
+  auto const ownedBefore = allocationCount;
+  auto const owned       = toml::parse_runtime(source);
+  if (allocationCount - ownedBefore > 2 || inside(owned.source, source)) {
+    return 4;
+  }
+  if (!inside(owned["name"].asString(), owned.source) || owned["server"]["ports"][1].as<std::int64_t>() != 443) {
+    return 5;
+  }
+}
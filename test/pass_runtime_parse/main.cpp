@@ -0,0 +1,88 @@
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr auto jsonCt = toml::to_json<sourceBytes>();
+
+auto parseErrorOf(std::string_view text) -> std::string {
+  try {
+    toml::parse_runtime(text);
+  } catch (std::string const& message) {
+    return message;
+  }
+  return {};
+}
+
+auto main() -> int {
+  auto const doc = toml::parse_runtime(std::string_view{sourceBytes.data(), sourceBytes.size()});
+
+  if (toml::to_json(doc) != std::string_view{jsonCt}) {
+    return 1;
+  }
+
+  auto const accessOk = doc["title"].asString() == "runtime"
+                     && doc.at<std::int64_t>("version") == 3
+                     && doc["ratio"].as<double>() == 0.75
+                     && doc["escaped"].asString() == "tab\tquote\" \u00e9"
+                     && doc["literal"].asString() == "C:\\path"
+                     && doc["multi"].asString() == "first\nsecond"
+                     && doc["started"].as<toml::OffsetDateTime>().time.hour == 7
+                     && doc["day"].as<toml::LocalDate>().day == 29
+                     && doc["server"]["ports"][2].as<std::int64_t>() == 8080
+                     && doc["server", "limits", "memory"].asString() == "2GiB"
+                     && doc["server"]["physical"]["color"].asString() == "orange"
+                     && !doc["server"]["tls"]["enabled"].as<bool>()
+                     && doc["clients"][1]["name"].asString() == "beta"
+                     && doc["wide"]["k11"].as<std::int64_t>() == 11;
+  if (!accessOk) {
+    return 2;
+  }
+
+  auto const findOk = doc.find<std::int64_t>("server", "limits", "cpu").value_or(0) == 4
+                   && !doc.find<std::int64_t>("server", "missing").has_value()
+                   && !doc.find<std::string_view>("clients", 5, "name").has_value()
+                   && doc["enabled"].as_or<std::int64_t>(-1) == -1
+                   && doc.at_or<std::string_view>("missing", "fallback") == "fallback";
+  if (!findOk) {
+    return 3;
+  }
+
+  auto const tagCount = doc["clients"][0]["tags"].visit([](auto const& value) -> std::size_t {
+    if constexpr (std::same_as<std::remove_cvref_t<decltype(value)>, toml::ValueRef>) {
+      return value.sizeOf(value.ptr);
+    } else {
+      return 0;
+    }
+  });
+  if (tagCount != 2) {
+    return 4;
+  }
+
+  auto const errorsOk = parseErrorOf("a = 1\na = 2\n") == "parse_runtime: E_DKEY at line 2, column 1"
+                     && parseErrorOf("a = {x = 1}\n[a]\n").starts_with("parse_runtime: E_DKEY")
+                     && parseErrorOf("n = 0x\n").starts_with("parse_runtime: E_IINT")
+                     && parseErrorOf("s = \"\\q\"\n").starts_with("parse_runtime: E_ISTR")
+                     && parseErrorOf("a = 1\rb = 2\n") == "parse_runtime: E_INL"
+                     && parseErrorOf("a = [1,,2]\n").starts_with("parse_runtime: E_IARR")
+                     && parseErrorOf("a = { b = 1 # c\n }\n").starts_with("parse_runtime: E_IINL")
+                     && parseErrorOf("a = {\n  b = 1,\n  c = 2\n}\n").empty();
+  if (!errorsOk) {
+    return 5;
+  }
+
+  // Up to two quotes may sit right before the closing delimiter of a multiline string.
+  auto const quotes = toml::parse_runtime("a = \"\"\"\"This,\" she said, \"is just a pointless statement.\"\"\"\"\n"
+                                          "b = [''''x''''']\n");
+  if (quotes["a"].asString() != "\"This,\" she said, \"is just a pointless statement.\""
+      || quotes["b"][0].asString() != "'x''") {
+    return 6;
+  }
+}
@@ -0,0 +1,94 @@
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+namespace {
+struct Transcript {
+  std::string out{};
+
+  auto path(char tag, toml::SaxPath keys) -> void {
+    out.push_back(tag);
+    for (auto const key: keys) {
+      out.push_back('/');
+      out.append(key);
+    }
+    out.push_back(' ');
+  }
+
+  auto on_table(toml::SaxPath keys) -> void { path('T', keys); }
+  auto on_array_table(toml::SaxPath keys) -> void { path('A', keys); }
+  auto on_key(toml::SaxPath keys) -> void { path('K', keys); }
+  auto on_array_begin() -> void { out.append("[ "); }
+  auto on_array_end() -> void { out.append("] "); }
+  auto on_inline_table_begin() -> void { out.append("{ "); }
+  auto on_inline_table_end() -> void { out.append("} "); }
+  auto on_comment(std::string_view text) -> void { out.append("#").append(text).append(" "); }
+
+  auto on_value(toml::ValueRef const& value) -> void {
+    switch (value.type) {
+    case toml::ValueType::string   : out.append("s:").append(value.asString()); break;
+    case toml::ValueType::integer  : out.append("i:").append(std::to_string(value.as<std::int64_t>())); break;
+    case toml::ValueType::boolean  : out.append(value.as<bool>() ? "b:1" : "b:0"); break;
+    case toml::ValueType::localDate: out.append("d:").append(std::to_string(value.as<toml::LocalDate>().day)); break;
+    default                        : out.append("?"); break;
+    }
+    out.push_back(' ');
+  }
+};
+
+struct KeysOnly {
+  std::size_t keys = 0;
+
+  auto on_key(toml::SaxPath) -> void { ++keys; }
+};
+
+auto saxErrorOf(std::string_view text) -> std::string {
+  try {
+    toml::sax_parse(text, KeysOnly{});
+  } catch (std::string const& message) {
+    return message;
+  }
+  return {};
+}
+}  // namespace
+
+auto main() -> int {
+  auto const source   = std::string_view{sourceBytes.data(), sourceBytes.size()};
+  auto       recorder = Transcript{};
+  toml::sax_parse(source, recorder);
+
+  auto const expected = std::string_view{
+    "# service K/title s:sax K/server/port i:8080 # inline K/escaped\tkey [ i:1 [ b:1 ] { K/id s:x\ny } ] "
+    "T/limits K/cpu i:4 A/jobs K/name s:first A/jobs K/when d:29 "
+  };
+  if (recorder.out != expected) {
+    return 1;
+  }
+
+  auto counter = KeysOnly{};
+  toml::sax_parse_file(std::filesystem::path{__FILE__}.parent_path() / "case.toml", counter);
+  if (counter.keys != 7) {
+    return 2;
+  }
+  try {
+    toml::sax_parse_file(std::filesystem::path{__FILE__}.parent_path() / "missing.toml", counter);
+    return 4;
+  } catch (std::string const& message) {
+    if (!message.starts_with("sax_parse_file: cannot open ")) {
+      return 5;
+    }
+  }
+
+  if (saxErrorOf("a = [1,,2]\n").find("sax_parse: E_") != 0 || saxErrorOf("a = 1\rb = 2\n") != "sax_parse: E_INL"
+      || saxErrorOf("[t\nx = 1\n").empty() || !saxErrorOf("a = 1\n[t]\nb = 2\n").empty()) {
+    return 3;
+  }
+}
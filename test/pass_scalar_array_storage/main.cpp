@@ -0,0 +1,54 @@
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr auto cfg = toml::parseEmbed<sourceBytes>();
+
+using Ports  = std::remove_cvref_t<decltype(cfg.ports)>;
+using Ratios = std::remove_cvref_t<decltype(cfg.ratios)>;
+using Flags  = std::remove_cvref_t<decltype(cfg.flags)>;
+using Names  = std::remove_cvref_t<decltype(cfg.names)>;
+
+static_assert(std::same_as<Ports, toml::ScalarArrayObject<std::int64_t, 3>>);
+static_assert(std::same_as<Ratios, toml::ScalarArrayObject<double, 3>>);
+static_assert(std::same_as<Flags, toml::ScalarArrayObject<bool, 3>>);
+static_assert(std::same_as<Names, toml::ScalarArrayObject<char const*, 2>>);
+static_assert(!std::same_as<std::remove_cvref_t<decltype(cfg.mixed)>, toml::ScalarArrayObject<std::int64_t, 2>>);
+static_assert(std::same_as<decltype(cfg.ports.span()), std::span<std::int64_t const, 3>>);
+
+auto main() -> int {
+  static_assert(cfg.ports.get<1>() == 443);
+  static_assert(cfg.ports.span()[2] == 8080);
+  static_assert(cfg.ratios.get<2>() == 2.5);
+  static_assert(!cfg.flags.get<1>());
+  static_assert(std::string_view{cfg.names.get<0>()} == "alpha");
+  static_assert(cfg["ports"][0].as_or<std::int64_t>(0) == 80);
+  static_assert(cfg.ports.size() == 3);
+  static_assert(!cfg["ports"][3].valid());
+  static_assert(cfg["names"][1].asString() == "beta");
+  static_assert(cfg["nested"][0][1].as_or<std::int64_t>(0) == 2);
+  static_assert(cfg["mixed"][1].as_or<double>(0.0) == 2.0);
+  static_assert(cfg.empty.size() == 0);
+
+  auto const span = cfg.ports.span();
+  if (std::accumulate(span.begin(), span.end(), std::int64_t{0}) != 80 + 443 + 8080) {
+    return 1;
+  }
+  std::int64_t sum = 0;
+  for (auto v: cfg.ports) {
+    sum += v.as<std::int64_t>();
+  }
+  if (sum != 80 + 443 + 8080) {
+    return 1;
+  }
+  return toml::to_json(cfg.flags) == "[true,false,true]" ? 0 : 1;
+}
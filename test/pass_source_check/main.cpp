@@ -0,0 +1,84 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+namespace {
+using toml::scan_detail::ScanPath;
+using toml::scan_detail::SourceCheck;
+
+static_assert(!toml::scan_detail::checkSource("a = 1\r\nb = 2\n").loneCarriageReturn);
+static_assert(toml::scan_detail::checkSource("a = 1\rb = 2\n").loneCarriageReturn);
+static_assert(toml::scan_detail::checkSource("a = \"\xC3\x28\"\n").malformedUtf8);
+static_assert(toml::scan_detail::checkSource("a = \"\xED\xA0\x80\"\n").malformedUtf8);
+static_assert(toml::scan_detail::checkSource("# \x01\n").controlCharacters);
+static_assert(!toml::scan_detail::checkSource("a = \"\xF0\x9F\x98\x80\"\t# ok\n").controlCharacters);
+
+auto sameCheck(SourceCheck const& a, SourceCheck const& b) -> bool {
+  return a.loneCarriageReturn == b.loneCarriageReturn && a.malformedUtf8 == b.malformedUtf8
+      && a.controlCharacters == b.controlCharacters;
+}
+
+auto agree(std::string_view input) -> bool {
+  auto const expected = toml::scan_detail::checkSourceScalar(input);
+  for (auto const path: {ScanPath::sse42, ScanPath::avx2}) {
+    if (!toml::scan_detail::isScanPathSupported(path)) {
+      continue;
+    }
+    if (!sameCheck(toml::scan_detail::sourceChecker(path)(input), expected)) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+auto main() -> int {
+  auto const source = std::string_view{sourceBytes.data(), sourceBytes.size()};
+  if (!sameCheck(toml::scan_detail::checkSource(source), SourceCheck{}) || !agree(source)) {
+    return 1;
+  }
+
+  for (std::size_t offset = 0; offset < 70; ++offset) {
+    auto const pad = std::string(offset, 'x');
+    for (unsigned lead = 0; lead < 256; ++lead) {
+      for (unsigned next = 0; next < 256; next += 5) {
+        auto input = pad;
+        input += static_cast<char>(lead);
+        input += static_cast<char>(next);
+        if (!agree(input) || !agree(input + "\xBF\x80z")) {
+          return 2;
+        }
+      }
+    }
+  }
+
+  constexpr auto alphabet = std::string_view{"a\r\n\t\x01\x7F\x80\xBF\xC2\xDF\xE0\xED\xEF\xF0\xF4\xF5\xA0\x90\x8F"};
+  auto           state    = std::uint64_t{0x2545F4914F6CDD1D};
+  for (std::size_t n = 0; n < 20000; ++n) {
+    state      = state * 6364136223846793005U + 1442695040888963407U;
+    auto input = std::string((state >> 33) % 160, 'a');
+    for (auto& c: input) {
+      state = state * 6364136223846793005U + 1442695040888963407U;
+      if ((state >> 60) < 4) {
+        c = alphabet[(state >> 20) % alphabet.size()];
+      }
+    }
+    if (!agree(input)) {
+      return 3;
+    }
+  }
+
+  auto const doc = toml::parse_borrowed(source);
+  if (doc["title"].asString() != "Zo\xC3\xAB \xE2\x80\x94 Z\xC3\xBCrich"
+      || doc["windows"]["path"].asString() != "C:\\tmp") {
+    return 4;
+  }
+}
@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+namespace {
+struct Transcript {
+  std::string out{};
+
+  auto path(char tag, toml::SaxPath keys) -> void {
+    out.push_back(tag);
+    for (auto const key: keys) {
+      out.push_back('/');
+      out.append(key);
+    }
+    out.push_back('\n');
+  }
+
+  auto on_table(toml::SaxPath keys) -> void { path('T', keys); }
+  auto on_array_table(toml::SaxPath keys) -> void { path('A', keys); }
+  auto on_key(toml::SaxPath keys) -> void { path('K', keys); }
+  auto on_value(toml::ValueRef const& value) -> void { out.append(toml::to_json(value)).push_back('\n'); }
+  auto on_array_begin() -> void { out.append("[\n"); }
+  auto on_array_end() -> void { out.append("]\n"); }
+  auto on_inline_table_begin() -> void { out.append("{\n"); }
+  auto on_inline_table_end() -> void { out.append("}\n"); }
+  auto on_comment(std::string_view text) -> void { out.append("#").append(text).push_back('\n'); }
+};
+
+struct Outcome {
+  std::string events{};
+  bool        ok = true;
+
+  auto operator==(Outcome const&) const -> bool = default;
+};
+
+auto oneShot(std::string_view text) -> Outcome {
+  auto recorder = Transcript{};
+  try {
+    toml::sax_parse(text, recorder);
+  } catch (std::string const&) {
+    return Outcome{recorder.out, false};
+  }
+  return Outcome{recorder.out, true};
+}
+
+template<typename Split>
+auto streamed(std::string_view text, Split split) -> Outcome {
+  auto recorder = Transcript{};
+  auto parser   = toml::StreamParser{recorder};
+  try {
+    split(parser, text);
+    parser.finish();
+  } catch (std::string const&) {
+    return Outcome{recorder.out, false};
+  }
+  return Outcome{recorder.out, true};
+}
+
+auto agrees(std::string_view text) -> bool {
+  auto const expected = oneShot(text);
+  for (std::size_t cut = 0; cut <= text.size(); ++cut) {
+    auto const outcome = streamed(text, [cut](auto& parser, std::string_view all) {
+      parser.feed(all.substr(0, cut));
+      parser.feed(all.substr(cut));
+    });
+    if (expected.ok ? outcome != expected : outcome.ok) {
+      return false;
+    }
+  }
+  auto const bytewise = streamed(text, [](auto& parser, std::string_view all) {
+    for (std::size_t i = 0; i < all.size(); ++i) {
+      parser.feed(all.substr(i, 1));
+    }
+  });
+  return expected.ok ? bytewise == expected : !bytewise.ok;
+}
+
+auto readFile(std::filesystem::path const& path) -> std::string {
+  auto file = std::ifstream{path, std::ios::binary};
+  return std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+auto streamErrorOf(std::string_view text) -> std::string {
+  auto parser = toml::StreamParser{Transcript{}};
+  try {
+    parser.feed(text);
+    parser.finish();
+  } catch (std::string const& message) {
+    return message;
+  }
+  return {};
+}
+}  // namespace
+
+auto main() -> int {
+  auto const source = std::string_view{sourceBytes.data(), sourceBytes.size()};
+  if (!oneShot(source).ok || !agrees(source)) {
+    return 1;
+  }
+
+  auto const testRoot = std::filesystem::path{__FILE__}.parent_path().parent_path();
+  std::size_t cases   = 0;
+  for (auto const& entry: std::filesystem::directory_iterator{testRoot}) {
+    auto const toml = entry.path() / "case.toml";
+    if (!std::filesystem::is_regular_file(toml)) {
+      continue;
+    }
+    ++cases;
+    if (!agrees(readFile(toml))) {
+      return 2;
+    }
+  }
+  if (cases < 2) {
+    return 3;
+  }
+
+  auto early  = Transcript{};
+  auto parser = toml::StreamParser{early};
+  parser.feed(std::string_view{"a = 1\nb = [\n"});
+  if (early.out != "K/a\n1\n" || parser.pending != "b = [\n") {
+    return 4;
+  }
+  parser.feed(std::string_view{"2]\n"});
+  parser.finish();
+  if (early.out != "K/a\n1\nK/b\n[\n2\n]\n" || !parser.pending.empty()) {
+    return 5;
+  }
+
+  if (streamErrorOf("a = 1\nb = 2\nc = [1,,2]\n").find("stream_parse: E_") != 0
+      || streamErrorOf("a = 1\nb = 2\nc = [1,,2]\n").find("at line 3") == std::string::npos) {
+    return 6;
+  }
+
+  // Quotes right before a closing delimiter belong to the string, not to a new one opened after it.
+  auto quotes = Transcript{};
+  auto runs   = toml::StreamParser{quotes};
+  runs.feed(std::string_view{"a = [\"\"\"x\"\"\"\"]\nb = 2\n"});
+  if (!quotes.out.ends_with("K/b\n2\n") || !runs.pending.empty()) {
+    return 7;
+  }
+  runs.feed(std::string_view{"c = '''y'''''\nd = 3\n"});
+  if (!quotes.out.ends_with("K/d\n3\n") || !runs.pending.empty()) {
+    return 8;
+  }
+  runs.finish();
+}
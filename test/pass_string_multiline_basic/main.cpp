@@ -11,5 +11,6 @@ constexpr auto cfg = toml::parseEmbed<sourceBytes>();
 
 auto main() -> int {
   static_assert(std::string_view{cfg.s} == "alpha\nbeta\n");
+  static_assert(std::string_view{cfg.quoted} == "\"This,\" she said, \"is just a pointless statement.\"");
   return cfg["s"].asString() == "alpha\nbeta\n" ? 0 : 1;
 }
@@ -11,5 +11,6 @@ constexpr auto cfg = toml::parseEmbed<sourceBytes>();
 
 auto main() -> int {
   static_assert(std::string_view{cfg.s} == "alpha\n\\nbeta\n");
+  static_assert(std::string_view{cfg.apos} == "'That,' she said, 'is still pointless.''");
   return cfg["s"].asString() == "alpha\n\\nbeta\n" ? 0 : 1;
 }
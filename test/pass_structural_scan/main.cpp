@@ -0,0 +1,99 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr auto jsonCt = toml::to_json<sourceBytes>();
+
+namespace {
+using toml::scan_detail::BlockMasks;
+using toml::scan_detail::ScanPath;
+
+auto isStructural(char c) -> bool {
+  auto const uc = static_cast<unsigned char>(c);
+  return (uc < 0x20U && c != '\t') || uc == 0x7FU || std::string_view{"\"'#=[]{},\\"}.contains(c);
+}
+
+auto isWhitespace(char c) -> bool { return c == ' ' || c == '\t' || c == '\r'; }
+
+auto randomBytes(std::size_t size) -> std::string {
+  auto out   = std::string(size, '\0');
+  auto state = std::uint64_t{0x9E3779B97F4A7C15};
+  for (auto& c: out) {
+    state = state * 6364136223846793005U + 1442695040888963407U;
+    c     = static_cast<char>(state >> 56);
+  }
+  return out;
+}
+
+auto allBytes() -> std::string {
+  auto out = std::string(256, '\0');
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    out[i] = static_cast<char>(i);
+  }
+  return out;
+}
+
+auto masksMatch(ScanPath path, std::string_view input) -> bool {
+  auto const blocks = input.size() / toml::scan_detail::blockBytes;
+  auto       masks  = std::vector<BlockMasks>(blocks);
+  toml::scan_detail::scanKernel(path)(input.data(), blocks, masks.data());
+  for (std::size_t i = 0; i < blocks * toml::scan_detail::blockBytes; ++i) {
+    auto const& m   = masks[i / toml::scan_detail::blockBytes];
+    auto const  bit = std::uint64_t{1} << (i % toml::scan_detail::blockBytes);
+    if (((m.structural & bit) != 0) != isStructural(input[i]) || ((m.whitespace & bit) != 0) != isWhitespace(input[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+auto queriesMatch(ScanPath path, std::string_view input) -> bool {
+  auto index   = toml::scan_detail::StructuralIndex{input};
+  index.kernel = toml::scan_detail::scanKernel(path);
+  auto expect  = [&](std::size_t from, auto pred) {
+    while (from < input.size() && !pred(input[from])) {
+      ++from;
+    }
+    return from;
+  };
+  for (std::size_t from = 0; from <= input.size(); ++from) {
+    if (index.nextStructural(from) != expect(from, isStructural)
+        || index.nextDelimiter(from) != expect(from, [](char c) { return isStructural(c) || isWhitespace(c); })
+        || index.skipWhitespace(from) != expect(from, [](char c) { return !isWhitespace(c); })) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+auto main() -> int {
+  auto const source = std::string_view{sourceBytes.data(), sourceBytes.size()};
+  auto const noise  = randomBytes(std::size_t{1} << 16);
+  auto const bytes  = allBytes();
+
+  for (auto const path: {ScanPath::scalar, ScanPath::sse42, ScanPath::avx2}) {
+    if (!toml::scan_detail::isScanPathSupported(path)) {
+      continue;
+    }
+    if (!masksMatch(path, bytes) || !masksMatch(path, noise) || !masksMatch(path, source)) {
+      return 1;
+    }
+    if (!queriesMatch(path, source) || !queriesMatch(path, std::string_view{noise}.substr(3, 40000))) {
+      return 2;
+    }
+  }
+
+  if (toml::to_json(toml::parse_borrowed(source)) != std::string_view{jsonCt}) {
+    return 3;
+  }
+}
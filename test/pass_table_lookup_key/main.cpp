@@ -0,0 +1,48 @@
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr auto cfg = toml::parseEmbed<sourceBytes>();
+
+consteval auto allWideKeysResolve() -> bool {
+  for (std::int64_t i = 0; i < 64; ++i) {
+    auto key = std::string{"key_"};
+    key.push_back(static_cast<char>('0' + i / 10));
+    key.push_back(static_cast<char>('0' + i % 10));
+    if (cfg["wide"][key].as_or<std::int64_t>(-1) != i) {
+      return false;
+    }
+  }
+  return true;
+}
+
+auto main() -> int {
+  static_assert(allWideKeysResolve());
+  static_assert(!cfg["wide"]["key_64"].valid());
+  static_assert(!cfg["wide"]["key_0"].valid());
+  static_assert(!cfg["wide"][""].valid());
+  static_assert(std::string_view{cfg["mixed"]["name"].asString()} == "Orange");
+  static_assert(cfg["mixed"]["quoted key"].as_or<bool>(false));
+  static_assert(cfg["mixed"]["a.b"].as_or<std::int64_t>(0) == 1);
+  static_assert(cfg["mixed"]["a"]["b"].as_or<std::int64_t>(0) == 2);
+
+  for (std::int64_t i = 0; i < 64; ++i) {
+    auto key = std::string{"key_"};
+    key.push_back(static_cast<char>('0' + i / 10));
+    key.push_back(static_cast<char>('0' + i % 10));
+    if (cfg["wide"][key].as_or<std::int64_t>(-1) != i) {
+      return 1;
+    }
+  }
+  if (cfg["wide"]["missing"].valid() || cfg["mixed"]["nam"].valid()) {
+    return 1;
+  }
+  return 0;
+}
@@ -21,6 +21,12 @@ static_assert(std::string_view{jsonCt}.find("\"clock\":\"14:15\"") != std::strin
 static_assert(std::string_view{jsonCt}.find("\"stamp\":\"2010-02-03T14:15:16Z\"") != std::string_view::npos);
 static_assert(std::string_view{jsonCtPre}.find("\n  \"name\"") != std::string_view::npos);
 
+constexpr auto jsonStatic = toml::to_json_static(cfg);
+static_assert(jsonStatic == jsonCt && jsonStatic.size() == toml::json_size(cfg));
+static_assert(jsonStatic.data()[jsonStatic.size()] == '\0');
+static_assert(toml::to_json_static(cfg.tbl) == "{\"x\":7}");
+static_assert(jsonCtPre.size() == toml::json_size(cfg, {.pretty = true, .indent = 2}));
+
 auto main() -> int {
   auto const jsonRt = toml::to_json(cfg);
   auto const ok     = !jsonRt.empty() && jsonRt.find("\"tbl\":{\"x\":7}") != std::string::npos;
@@ -0,0 +1,50 @@
+#include <array>
+#include <string>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr auto source = std::string_view{sourceBytes.data(), sourceBytes.size()};
+constexpr auto cfg    = toml::parseEmbed<sourceBytes>();
+constexpr auto parsed = toml::parse_with_meta<sourceBytes>();
+
+// With meta the canonical source comes back byte for byte: comments, inline table, dotted keys, implicit
+// `servers` super-table and the array of tables.
+static_assert(toml::to_toml(parsed) == source);
+static_assert(toml::toml_size(parsed) == source.size());
+
+// Without meta every table gets a header and `servers` is still implied by `[servers.alpha]`.
+static_assert(toml::to_toml(cfg).find("\n[physical]\ncolor = \"orange\"\n") != std::string::npos);
+static_assert(toml::to_toml(cfg).find("[servers]") == std::string::npos);
+static_assert(toml::to_toml(cfg).find("\n[owner]\nname = \"ops\"\n") != std::string::npos);
+static_assert(toml::to_toml(cfg).find("#") == std::string::npos);
+static_assert(toml::to_toml(cfg.owner) == "name = \"ops\"\npager = false\n");
+static_assert(toml::toml_size(cfg) == toml::to_toml(cfg).size());
+
+auto main() -> int {
+  auto const doc  = toml::parse_runtime(source);
+  auto const text = toml::to_toml(doc);
+  if (toml::to_toml(toml::parse_runtime(text)) != text) {
+    return 1;
+  }
+  if (toml::to_json(toml::parse_runtime(toml::to_toml(parsed))) != toml::to_json(cfg)) {
+    return 1;
+  }
+
+  auto reserved = std::string{};
+  reserved.reserve(toml::toml_size(doc));
+  auto const* const data = reserved.data();
+  toml::to_toml(doc, reserved);
+  if (reserved != text || reserved.data() != data) {
+    return 1;
+  }
+
+  auto escaped = toml::parse_runtime("\"a b\" = \"tab\\there\\u007F\"\nx = 1e300\ny = -0.0\nz = -inf\n");
+  if (toml::to_toml(escaped) != "\"a b\" = \"tab\\there\\u007F\"\nx = 1e+300\ny = -0.0\nz = -inf\n") {
+    return 1;
+  }
+}
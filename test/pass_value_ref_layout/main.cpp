@@ -0,0 +1,37 @@
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#include "toml26/toml.hpp"
+
+static constexpr auto sourceBytes = std::to_array<char>({
+#embed "case.toml"
+});
+
+constexpr auto cfg = toml::parseEmbed<sourceBytes>();
+
+// Type, object and a pointer to the shared per-representation operations.
+static_assert(sizeof(toml::ValueRef) == 3 * sizeof(void*));
+
+// Missing operations behave as on an empty value.
+static_assert(toml::ValueRef{}.sizeOf(nullptr) == 0);
+static_assert(!toml::ValueRef{}.lookupByIndex(nullptr, 0).valid());
+static_assert(!cfg["i"].lookupByKey(cfg["i"].ptr, "x").valid());
+
+// Scalars share the empty operations table.
+static_assert(cfg["i"].ops == toml::ValueRef{}.ops);
+
+auto main() -> int {
+  auto const doc   = toml::parse_runtime(std::string_view{sourceBytes.data(), sourceBytes.size()});
+  auto const items = doc["arr"]["items"];
+  if (items.sizeOf(items.ptr) != 3 || items.lookupByIndex(items.ptr, 1).asString() != "two") {
+    return 1;
+  }
+  // Handles of one representation share one operations table.
+  if (doc["tbl"].ops != doc["arr"].ops || doc["tbl"].lookupByKey(doc["tbl"].ptr, "x").as<std::int64_t>() != 7) {
+    return 2;
+  }
+  if (doc["i"].sizeOf(doc["i"].ptr) != 0 || doc["i"].lookupByIndex(doc["i"].ptr, 0).valid()) {
+    return 3;
+  }
+}